@@ -608,6 +608,35 @@
   #endif
 #endif // PIDTEMP
 
+/**
+ * Model Predictive Control for hotend
+ *
+ * Use a physical model of the hotend to control temperature. Heat-up runs at
+ * full power and stops short of the target as the model predicts, avoiding
+ * overshoot, and fan speed and extrusion rate are compensated directly.
+ * Disable PIDTEMP to use this. Tune with 'M306 T' and save with M500.
+ */
+//#define MPCTEMP
+#if ENABLED(MPCTEMP)
+  #define MPC_MAX BANG_MAX                              // (0..255) Current to nozzle while MPC is active.
+  #define MPC_HEATER_POWER { 40.0f }                    // (W) Heat cartridge powers.
+
+  // Measured physical constants from M306
+  #define MPC_BLOCK_HEAT_CAPACITY { 16.7f }             // (J/K) Heat block heat capacities.
+  #define MPC_SENSOR_RESPONSIVENESS { 0.22f }           // (1/s) Sensor responsivenesses.
+  #define MPC_AMBIENT_XFER_COEFF { 0.068f }             // (W/K) Heat transfer coefficients from heat block to room air with fan off.
+  #define MPC_AMBIENT_XFER_COEFF_FAN255 { 0.097f }      // (W/K) Heat transfer coefficients with fan on full.
+
+  // Filament heat capacity per mm, for extrusion losses
+  #define FILAMENT_HEAT_CAPACITY_PERMM { 5.6e-3f }      // 0.0056 J/K/mm for 1.75mm PLA (0.0149 J/K/mm for 2.85mm PLA).
+
+  // Advanced options
+  #define MPC_SMOOTHING_FACTOR 0.5f                     // (0.0...1.0) Noisy temperature sensors may need a lower value for stabilization.
+  #define MPC_MAX_AMBIENT_CHANGE 1.0f                   // (K/s) Fastest the modeled ambient temperature may follow the measurement.
+  #define MPC_TUNING_SETTLE_TIME 20                     // (s) M306 T settling and averaging time at the target.
+  #define MPC_TUNING_TEMP 200                           // (°C) Default M306 T target temperature.
+#endif
+
 //===========================================================================
 //====================== PID > Bed Temperature Control ======================
 //===========================================================================
@@ -1234,6 +1263,24 @@
 #define MULTIPLE_PROBING 2
 //#define EXTRA_PROBING    1
 
+/**
+ * Faster double-probing (MULTIPLE_PROBING 2) for G29 and friends.
+ *  - The raise after each probe is queued behind the probing move, so it begins
+ *    as soon as the probe triggers. The height comes from the endstop interrupt.
+ *  - When PROBE_FAST_TRUST points in a row have the same fast/slow difference,
+ *    within PROBE_FAST_TOLERANCE, the slow probe is skipped and the fast result
+ *    is corrected by that difference. A full double-probe is done again every
+ *    PROBE_FAST_RECHECK points, and a mismatch goes back to probing every point twice.
+ * The comparison starts over each time the probe is deployed.
+ * EXPERIMENTAL: Skipped slow probes can change mesh and M48 results.
+ */
+//#define PROBE_FAST_MULTI
+#if ENABLED(PROBE_FAST_MULTI)
+  #define PROBE_FAST_TOLERANCE 0.01 // (mm) Allowed spread of the fast/slow difference
+  #define PROBE_FAST_TRUST     3    // Agreeing double-probes needed before skipping slow probes
+  #define PROBE_FAST_RECHECK   4    // Double-probe again after this many fast-only points
+#endif
+
 /**
  * Z probes require clearance when deploying, stowing, and moving between
  * probe points to avoid hitting the bed and other hardware.
@@ -1584,6 +1631,8 @@
   // contours of the bed more closely than edge-to-edge straight moves.
   #define SEGMENT_LEVELED_MOVES
   #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
+  //#define LEVELED_SEGMENT_TOLERANCE 0.005 // (mm) Instead, split only at mesh lines and where the mesh
+                                            // departs from a straight segment by more than this amount
 
   /**
    * Enable the G26 Mesh Validation Pattern tool.
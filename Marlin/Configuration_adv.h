@@ -137,6 +137,17 @@
   #define REDUNDANT_BETA                   3950    // Beta value
 #endif
 
+/**
+ * ADC to temperature conversion without a table search or logf()
+ *  - Thermistor tables are resampled at compile time to one entry per ADC count,
+ *    so a reading is converted with an index and one interpolation instead of a
+ *    table search. Uses about 2K of flash for each table in use.
+ *  - Custom thermistors (1000) get their logarithm from integer math instead of logf().
+ * The gain in speed hasn't been measured on an MCU.
+ * Requires a C++14 compiler (i.e., not AVR).
+ */
+//#define FAST_THERMISTOR_CONVERSION
+
 /**
  * Configuration options for MAX Thermocouples (-2, -3, -5).
  *   FORCE_HW_SPI:   Ignore SCK/MOSI/MISO pins and just use the CS pin & default SPI bus.
@@ -999,8 +1010,36 @@
 #define SLOWDOWN
 #if ENABLED(SLOWDOWN)
   #define SLOWDOWN_DIVISOR 2
+  // Once the buffer is below the divisor's share, slow down by how long the queued moves
+  // will take instead of how many there are. Short segments are stretched up to 2x as the
+  // buffered time runs out. Ignores M205 B.
+  //#define SLOWDOWN_BY_TIME
+  #if ENABLED(SLOWDOWN_BY_TIME)
+    #define SLOWDOWN_BUFFER_MS 150      // (ms) Start slowing down with less than this much motion queued
+  #endif
 #endif
 
+/**
+ * Planner starvation monitor
+ * While printing, count the moves that start with nothing queued behind them
+ * (so they must slow to a stop), the time the planner sits empty, and the
+ * fewest blocks queued in each layer. Heating and waits for moves to finish
+ * (M400, G4, homing...) are left out.
+ * M576 reports. M576 S<seconds> reports periodically, M576 L1 after each layer.
+ */
+//#define PLANNER_STARVATION_MONITOR
+
+/**
+ * Remaining time estimate
+ * Count down the remaining print time from the moves already queued, which
+ * are timed through their real acceleration profile, plus an estimate for
+ * the rest of the file: the slicer's M73 R scaled by how its times have
+ * compared with the planner's so far, or for SD prints without M73 R the
+ * planned time per byte so far. M31 reports it, and so does the LCD with
+ * SHOW_REMAINING_TIME.
+ */
+//#define REMAINING_TIME_ESTIMATE
+
 /**
  * XY Frequency limit
  * Reduce resonance by limiting the frequency of small zigzag infill moves.
@@ -1017,6 +1056,32 @@
 // if unwanted behavior is observed on a user's machine when running at very slow speeds.
 #define MINIMUM_PLANNER_SPEED 0.05 // (mm/s)
 
+/**
+ * Delta Incremental Inverse Kinematics
+ * Step the tower heights of a segmented straight move with a recurrence and one
+ * Newton step per tower instead of three square roots per segment. This allows
+ * a higher DELTA_SEGMENTS_PER_SECOND on slower boards. The exact IK is used for
+ * the last segment of each move and every DELTA_IK_RESYNC segments.
+ * Use M665 V to see how many segments took each path.
+ */
+//#define DELTA_INCREMENTAL_IK
+#if ENABLED(DELTA_INCREMENTAL_IK)
+  #define DELTA_IK_RESYNC 16  // Segments between exact solutions
+#endif
+
+/**
+ * Kinematic Segment Tolerance
+ * Split DELTA and SCARA moves into as few segments as will keep the nozzle within
+ * this distance of the straight line, instead of by DELTA_SEGMENTS_PER_SECOND or
+ * SCARA_SEGMENTS_PER_SECOND. Moves near the middle of the workspace need far fewer
+ * segments, and moves near the edge get more. Use M665 V to compare the counts.
+ */
+//#define KINEMATIC_SEGMENT_TOLERANCE 0.01 // (mm)
+#ifdef KINEMATIC_SEGMENT_TOLERANCE
+  #define KINEMATIC_SEGMENT_MIN_LENGTH 0.1 // (mm) Never split into pieces shorter than this
+  #define KINEMATIC_SEGMENT_MIN_RATE    20 // (segments/s) Never fewer, so long moves still get several blocks
+#endif
+
 //
 // Backlash Compensation
 // Adds extra movement to axes on direction-changes to account for backlash.
@@ -1476,6 +1541,55 @@
    */
   //#define AUTO_REPORT_SD_STATUS
 
+  /**
+   * Remember runs of contiguous clusters in the open file so sequential
+   * reads and seeks rarely have to fetch FAT blocks, and read whole runs
+   * straight into the caller's buffer with one multi-block command.
+   * Report read throughput with M27 T.
+   */
+  #define SD_EXTENT_CACHE
+  #if ENABLED(SD_EXTENT_CACHE)
+    #define SD_EXTENT_CACHE_SIZE 4          // Cluster runs remembered per open file. 12 bytes each.
+  #endif
+
+  /**
+   * Read the next block of a cluster in the background while the current
+   * one is used, on drivers that can (STM32F1 SDIO). Uses 512 bytes of RAM.
+   * The read is finished by polling before the block is used; there is
+   * no completion callback. With SD_EXTENT_CACHE, M27 T shows the time
+   * still spent waiting.
+   * EXPERIMENTAL: Untested on a board. Throughput and stall time have
+   * not been measured.
+   */
+  //#define SD_READ_AHEAD
+
+  /**
+   * Faster uploads with M28 and BINARY_FILE_TRANSFER. Received data is
+   * gathered into whole blocks, the file grows by a contiguous group of
+   * clusters at a time, and whole blocks inside a group are written with
+   * one multi-block command. Unused clusters are freed on M29, on an abort
+   * or outage, and at every file sync. M29 and M27 T report the upload rate.
+   * Pair with HOST_ACK_WINDOW so the host can keep several lines in flight.
+   *
+   * A write error is reported when the buffer is written, naming the lines
+   * it held. A reset during an upload can leave up to SD_UPLOAD_PREALLOCATE
+   * of lost clusters for a PC disk check to reclaim.
+   */
+  //#define SD_STREAMING_UPLOAD
+  #if ENABLED(SD_STREAMING_UPLOAD)
+    #define SD_UPLOAD_BUFFER_BLOCKS   4     // 512-byte blocks gathered before each write (RAM)
+    #define SD_UPLOAD_PREALLOCATE  1024     // (KB) Space allocated each time the file runs out
+  #endif
+
+  /**
+   * Print from G-code files compressed by buildroot/share/scripts/gcode_compress.py.
+   * They are recognized by their header, so they can keep any *.g* name.
+   * The G-code is split into independently compressed blocks with an index,
+   * so M26, M808 loops and power-loss recovery work on uncompressed positions.
+   * Uses the BINARY_FILE_TRANSFER heatshrink decoder. About 400 bytes of RAM.
+   */
+  //#define SD_COMPRESSED_GCODE
+
   /**
    * Support for USB thumb drives using an Arduino USB Host Shield or
    * equivalent MAX3421E breakout board. The USB thumb drive will appear
@@ -1905,6 +2019,9 @@
  * If this algorithm produces a higher speed offset than the extruder can handle (compared to E jerk)
  * print acceleration will be reduced during the affected moves to keep within the limit.
  *
+ * The advance is derived from the step rate of each block and is stepped along with the
+ * regular E steps (at most one E step per step event), so pressure carries across junctions.
+ *
  * See https://marlinfw.org/docs/features/lin_advance.html for full instructions.
  */
 #define LIN_ADVANCE
@@ -2152,10 +2269,13 @@
 
 // The number of linear moves that can be in the planner at once.
 // The value of BLOCK_BUFFER_SIZE must be a power of 2 (e.g., 8, 16, 32)
+// SD builds use 32 blocks. At the stock SV05's 84 bytes per block that is 2688 bytes
+// of RAM, 1152 bytes more than the 16 blocks of 96 bytes used before block_t was
+// compacted. Use 16 to get that RAM back. The block size is reported at startup.
 #if BOTH(SDSUPPORT, DIRECT_STEPPING)
   #define BLOCK_BUFFER_SIZE  8
 #elif ENABLED(SDSUPPORT)
-  #define BLOCK_BUFFER_SIZE 16
+  #define BLOCK_BUFFER_SIZE 32
 #else
   #define BLOCK_BUFFER_SIZE 16
 #endif
@@ -2242,6 +2362,18 @@
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
 //#define ADVANCED_OK
 
+/**
+ * Windowed host acknowledgement
+ * The host may keep several numbered lines in flight instead of waiting for
+ * each "ok". Lines are acknowledged as they are queued, with one "ok N<line>"
+ * per batch. Enabled by the host with 'M110 N<line> W<lines>' (ACK_WINDOW in M115).
+ * On a line error the host resends everything from the requested line.
+ */
+//#define HOST_ACK_WINDOW
+#if ENABLED(HOST_ACK_WINDOW)
+  #define HOST_ACK_WINDOW_MAX 8   // Most lines allowed in flight. Keep lines x line length below the RX buffer size.
+#endif
+
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
 #define SERIAL_OVERRUN_PROTECTION
@@ -3604,6 +3736,18 @@
  */
 //#define AUTO_REPORT_POSITION
 
+/**
+ * Binary telemetry with M156 P<milliseconds>
+ * Send temperatures, fans, buffer levels, SD position and stepper positions
+ * as a compact COBS-framed binary record with a CRC16. Each frame is delimited
+ * by zero bytes so hosts can separate it from text replies.
+ * See feature/binary_telemetry.h for the frame layout.
+ */
+//#define BINARY_TELEMETRY
+#if ENABLED(BINARY_TELEMETRY)
+  #define BINARY_TELEMETRY_MIN_INTERVAL 50  // (ms) Shortest interval accepted by M156
+#endif
+
 /**
  * Include capabilities in M115 output
  */
@@ -4188,6 +4332,31 @@
 //
 //#define PINS_DEBUGGING
 
+/**
+ * M131 - Critical section tracer
+ * Time every stretch with interrupts disabled and every stretch with the
+ * Stepper ISR held off (Stepper::suspend), keeping the count and the worst
+ * and average time for each call site. M131 lists them worst first.
+ * Uses the DWT cycle counter on Cortex-M3/M4, micros() elsewhere.
+ * The LINUX HAL also writes the list to critical_trace.csv.
+ */
+//#define CRITICAL_SECTION_TRACE
+#if ENABLED(CRITICAL_SECTION_TRACE)
+  #define CRITICAL_TRACE_SITES 24     // Call sites to keep. 24 bytes each.
+#endif
+
+/**
+ * M132 - Event trace
+ * Record planner, stepper, command queue, SD, heater and display events with
+ * timestamps in a RAM ring, overwriting the oldest. M132 sends the ring to the
+ * host for buildroot/share/scripts/event_trace.py to convert into a Chrome /
+ * Perfetto timeline. Use it to see what the firmware was doing during a stall.
+ */
+//#define EVENT_TRACE
+#if ENABLED(EVENT_TRACE)
+  #define EVENT_TRACE_SIZE 512        // Records to keep, a power of 2. 8 bytes each.
+#endif
+
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
 
@@ -23,6 +23,14 @@
 
 #include "../../inc/MarlinConfig.h"
 #include "../shared/Delay.h"
+#include "../../gcode/queue.h"
+#include "../../module/planner.h"
+
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+  #include "estimator.h"
+#endif
+
+#include <poll.h>
 
 MSerialT usb_serial(TERN0(EMERGENCY_PARSER, true));
 
@@ -36,6 +44,35 @@ extern "C" {
 
 //************************//
 
+/**
+ * Sleep until new serial input, an interrupt (the timer ISRs are signals on
+ * this thread) or 10ms, unless a queued command can run now. A command that
+ * stays at the head of the queue across idle() calls is waiting on something
+ * (heating, a dwell, a full planner) and doesn't count.
+ *
+ * The print time estimator has no steppers, so it retires a block instead.
+ */
+void HAL_idletask() {
+  #if ENABLED(PRINT_TIME_ESTIMATOR)
+    PrintTimeEstimator::idle();
+    return;
+  #endif
+  static uint8_t last_r, passes;
+  const bool runnable = queue.has_commands_queued() && !planner.is_full();
+  passes = (runnable && queue.ring_buffer.index_r == last_r) ? _MIN(passes + 1, 2) : 0;
+  last_r = queue.ring_buffer.index_r;
+  if ((runnable && passes < 2) || usb_serial.data_fd < 0) return;
+
+  usb_serial.want_data = true;
+  if (usb_serial.receive_buffer.empty()) {
+    pollfd p = { usb_serial.data_fd, POLLIN, 0 };
+    poll(&p, 1, 10);
+  }
+  usb_serial.want_data = false;
+  uint64_t v;
+  if (read(usb_serial.data_fd, &v, sizeof(v)) < 0) { /* nothing signalled */ }
+}
+
 // return free heap space
 int freeMemory() {
   return 0;
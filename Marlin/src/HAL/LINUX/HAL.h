@@ -78,6 +78,10 @@ extern MSerialT usb_serial;
 
 inline void HAL_init() {}
 
+// Sleep while there's nothing to do, so idle instances don't each hold a core
+#define HAL_IDLETASK 1
+void HAL_idletask();
+
 // Utility functions
 #if GCC_VERSION <= 50000
   #pragma GCC diagnostic push
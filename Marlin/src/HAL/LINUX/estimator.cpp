@@ -0,0 +1,184 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+
+#include "estimator.h"
+#include "../../MarlinCore.h"
+#include "../../gcode/gcode.h"
+#include "../../module/motion.h"
+#include "../../module/planner.h"
+#include "../../module/temperature.h"
+
+#include <string.h>
+#include <time.h>
+
+std::vector<PrintTimeEstimator::layer_t> PrintTimeEstimator::layers;
+uint16_t PrintTimeEstimator::block_layer[BLOCK_BUFFER_SIZE];
+uint8_t PrintTimeEstimator::tagged_head;
+float PrintTimeEstimator::pending_seconds, PrintTimeEstimator::layer_z, PrintTimeEstimator::last_e;
+uint32_t PrintTimeEstimator::pending_blocks;
+
+void PrintTimeEstimator::idle() {
+  // Wait out the first-block delay, as the Stepper ISR would
+  block_t *block = nullptr;
+  for (uint16_t tries = 1000; planner.has_blocks_queued() && tries && !(block = planner.get_current_block()); --tries) {}
+  if (!block) return;
+
+  const float seconds = planner.block_time(block);  // Zero for sync blocks. The stepper counts never move.
+
+  // A block retired before its line ended has no layer yet
+  const uint8_t b = planner.block_buffer_tail;
+  if (b == tagged_head) {
+    pending_seconds += seconds;
+    pending_blocks++;
+    tagged_head = BLOCK_MOD(b + 1);
+  }
+  else {
+    layer_t &l = layers[block_layer[b]];
+    l.seconds += seconds;
+    l.blocks++;
+  }
+
+  planner.release_current_block();
+}
+
+/**
+ * Handle the commands that wait on something other than motion.
+ * Return true if the command shouldn't run.
+ */
+bool PrintTimeEstimator::skip_command() {
+  const uint16_t code = parser.codenum;
+  if (parser.command_letter == 'G') switch (code) {
+    case 4: {                                     // Dwell: finish the moves, then add the wait
+      planner.synchronize();
+      const float s = parser.seenval('P') ? parser.value_millis() * 0.001f : parser.seenval('S') ? parser.value_float() : 0;
+      layers.back().seconds += s;
+      return true;
+    }
+    case 28: {                                    // Homing: at home in no time
+      planner.synchronize();
+      const bool home_all = !parser.seen_axis();
+      LOOP_LINEAR_AXES(a) if (home_all || parser.seen(AXIS_CHAR(a))) set_axis_is_at_home(AxisEnum(a));
+      sync_plan_position();
+      return true;
+    }
+    case 29: case 30: case 33: case 34: case 35:  // Probing
+      return true;
+  }
+  else if (parser.command_letter == 'M') switch (code) {
+    case 0: case 1: case 24: case 25: case 109: case 125: case 190: case 191: case 303: case 600:
+      return true;
+  }
+  return false;
+}
+
+// Start a new layer with the first extruding move above the last, and give the line's blocks their layer
+void PrintTimeEstimator::end_line() {
+  if (current_position.e > last_e && current_position.z > layer_z + 0.001f) {
+    layer_z = current_position.z;
+    layers.push_back({ layer_z, 0, 0 });
+  }
+  last_e = current_position.e;
+
+  layer_t &l = layers.back();
+  l.seconds += pending_seconds;
+  l.blocks += pending_blocks;
+  pending_seconds = 0;
+  pending_blocks = 0;
+
+  const uint16_t n = layers.size() - 1;
+  for (; tagged_head != planner.block_buffer_head; tagged_head = BLOCK_MOD(tagged_head + 1))
+    block_layer[tagged_head] = n;
+}
+
+void PrintTimeEstimator::write_csv(FILE * const f) {
+  fprintf(f, "layer,z,seconds,blocks,cumulative\n");
+  float total = 0;
+  for (size_t i = 0; i < layers.size(); i++) {
+    const layer_t &l = layers[i];
+    total += l.seconds;
+    fprintf(f, "%u,%.3f,%.3f,%u,%.3f\n", unsigned(i), l.z, l.seconds, unsigned(l.blocks), total);
+  }
+}
+
+int PrintTimeEstimator::run(const char * const gcode_path, const char * const csv_path) {
+  FILE * const in = fopen(gcode_path, "r");
+  if (!in) { perror(gcode_path); return 1; }
+
+  TERN_(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude = true); // Heating is skipped
+
+  // Layer 0 holds everything before the first layer: start G-code, homing...
+  layers.clear();
+  layers.push_back({ current_position.z, 0, 0 });
+  layer_z = -999;
+  last_e = current_position.e;
+  tagged_head = planner.block_buffer_head;
+
+  ::idle();   // One-time work (looking for an SD card...) shouldn't count toward the CPU time
+
+  const clock_t cpu_start = clock();
+  uint32_t lines = 0;
+  char line[MAX_CMD_SIZE + 64];
+  while (fgets(line, sizeof(line), in)) {
+    // Drop the comment and surrounding space
+    char *c = strchr(line, ';');
+    if (c) *c = '\0';
+    for (c = line + strlen(line); c > line && isspace(c[-1]);) *--c = '\0';
+    char *cmd = line;
+    while (isspace(*cmd)) cmd++;
+    if (!*cmd) continue;
+
+    lines++;
+    parser.parse(cmd);
+    if (!skip_command()) gcode.process_parsed_command(true);
+    end_line();
+  }
+  fclose(in);
+
+  planner.synchronize();
+  end_line();
+  const float cpu_seconds = float(clock() - cpu_start) / CLOCKS_PER_SEC;
+
+  float total = 0;
+  uint32_t blocks = 0;
+  for (const layer_t &l : layers) { total += l.seconds; blocks += l.blocks; }
+
+  if (csv_path) {
+    FILE * const out = fopen(csv_path, "w");
+    if (!out) { perror(csv_path); return 1; }
+    write_csv(out);
+    fclose(out);
+  }
+
+  const uint32_t t = total + 0.5f;
+  fprintf(stderr, "estimate: %u lines, %u blocks, %u layers\n", unsigned(lines), unsigned(blocks), unsigned(layers.size() - 1));
+  fprintf(stderr, "estimate: print time %uh %02um %02us (%.1fs), computed in %.2fs of CPU\n",
+    unsigned(t / 3600), unsigned(t / 60 % 60), unsigned(t % 60), total, cpu_seconds);
+  return 0;
+}
+
+#endif // PRINT_TIME_ESTIMATOR
+#endif // __PLAT_LINUX__
@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Offline print time estimator (build with -DPRINT_TIME_ESTIMATOR)
+ *
+ * Runs a G-code file through the G-code handlers and the real Planner, so
+ * junction deviation or jerk, SLOWDOWN, LIN_ADVANCE limits and every other
+ * setting shape the moves exactly as on the printer. Nothing is stepped: the
+ * Stepper ISR never starts, and each block is retired as soon as a command
+ * has to wait for one, adding up the time its trapezoid takes. The planner
+ * stays full while commands keep coming, as it would printing from SD.
+ *
+ * Commands that wait on the outside world don't count toward the time:
+ * heating (M109, M190, M191) and user waits are skipped, homing puts the axes
+ * at home instantly, and probing is skipped. G4 dwells add their time.
+ *
+ * A layer begins with the first extruding move above the last layer. The
+ * time per layer goes to a CSV file, and a summary to stderr.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+class PrintTimeEstimator {
+public:
+  // Run the file and write the profile. Returns an exit code.
+  static int run(const char * const gcode_path, const char * const csv_path);
+
+  // From HAL_idletask(), whenever a command is waiting. Retires one block.
+  static void idle();
+
+private:
+  struct layer_t {
+    float z, seconds;
+    uint32_t blocks;
+  };
+
+  static std::vector<layer_t> layers;
+  static uint16_t block_layer[];                  // The layer each tagged block belongs to
+  static uint8_t tagged_head;                     // The first block not yet given a layer
+  static float pending_seconds;                   // Retired before the line that queued it ended
+  static uint32_t pending_blocks;
+  static float layer_z, last_e;
+
+  static bool skip_command();
+  static void end_line();
+  static void write_csv(FILE * const f);
+};
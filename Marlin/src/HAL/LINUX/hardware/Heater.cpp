@@ -24,37 +24,98 @@
 #include "Clock.h"
 #include <stdio.h>
 #include "../../../inc/MarlinConfig.h"
+#include "../../../module/planner.h"
 
 #include "Heater.h"
 
-Heater::Heater(pin_t heater, pin_t adc) {
-  heater_state = 0;
-  room_temp_raw = 150;
-  last = Clock::micros();
-  heater_pin = heater;
-  adc_pin = adc;
-  heat = 0.0;
+Heater::Heater(pin_t heater, pin_t adc, const model_t &heater_model, const temp_entry_t *temp_table, const uint8_t temp_table_len)
+  : heater_pin(heater), adc_pin(adc), fan_pin(-1), model(heater_model), table(temp_table), table_len(temp_table_len),
+    extruder(nullptr), filament_area(0), last_e(0), on_ns(0), last_on_ns(0)
+{
+  temp = sensor = model.ambient;
+  last = Clock::nanos();
+  on_since = last;
+  if (table_len) Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = adc_value(sensor);
+  Gpio::attachPeripheral(heater_pin, this);
 }
 
 Heater::~Heater() {
 }
 
+void Heater::attach_extruder(const LinearAxis *axis, const float filament_dia) {
+  extruder = axis;
+  filament_area = M_PI * sq(filament_dia) / 4;
+  last_e = axis->position;
+}
+
 void Heater::update() {
-  // crude pwm read and cruder heat simulation
-  auto now = Clock::micros();
-  double delta = (now - last);
-  if (delta > 1000 ) {
-    heater_state = pwmcap.update(0xFFFF * Gpio::pin_map[heater_pin].value);
-    last = now;
-    heat += (heater_state - heat) * (delta / 1000000000.0);
-
-    NOLESS(heat, room_temp_raw);
-    Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = 0xFFFF - (uint16_t)heat;
+  const uint64_t now = Clock::nanos();
+  if (now - last < 1000000) return;
+  const float dt = (now - last) * 1e-9f;
+  last = now;
+
+  // Average heater duty since the last update. An interval still open counts up to now.
+  float duty;
+  const uint16_t level = Gpio::pin_map[heater_pin].value;
+  if (level > 1)
+    duty = level / 255.0f;  // analogWrite
+  else {
+    const uint64_t on = on_ns + (level ? now - on_since : 0);
+    duty = constrain((on - last_on_ns) * 1e-9f / dt, 0.0f, 1.0f);
+    last_on_ns = on;
+  }
+
+  float fan = 0;
+  if (Gpio::valid_pin(fan_pin)) {
+    const uint16_t f = Gpio::pin_map[fan_pin].value;
+    fan = f > 1 ? f / 255.0f : f;
+  }
+
+  float flow = 0;           // (mm^3/s) Retraction takes no heat
+  if (extruder) {
+    const int32_t e = extruder->position;
+    const float steps_per_mm = planner.settings.axis_steps_per_mm[E_AXIS];
+    if (e > last_e && steps_per_mm > 0) flow = (e - last_e) / steps_per_mm * filament_area / dt;
+    last_e = e;
   }
+
+  const float loss = model.loss + model.fan_loss * fan + model.flow_heat * flow;
+  for (float left = dt; left > 0;) {
+    const float h = _MIN(left, 0.01f);
+    left -= h;
+    temp += (model.power * duty - loss * (temp - model.ambient)) / model.capacity * h;
+    sensor += (temp - sensor) * _MIN(1.0f, h / model.sensor_lag);
+  }
+
+  if (table_len) Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = adc_value(sensor);
 }
 
 void Heater::interrupt(GpioEvent ev) {
-  // unused
+  if (ev.pin_id != heater_pin) return;
+  if (ev.event == GpioEvent::RISE)
+    on_since = ev.timestamp;
+  else if (ev.event == GpioEvent::FALL)
+    on_ns += ev.timestamp - on_since;
+}
+
+// The ADC reading for a temperature, from the thermistor table
+uint16_t Heater::adc_value(const float celsius) const {
+  auto cel = [&](const uint8_t i) { return float(int16_t(pgm_read_word(&table[i].celsius))); };
+  auto raw = [&](const uint8_t i) { return float(int16_t(pgm_read_word(&table[i].value))); };
+
+  // Tables run either way in temperature. Past either end, use the closer end.
+  const uint8_t last_i = table_len - 1;
+  float value = ABS(celsius - cel(0)) < ABS(celsius - cel(last_i)) ? raw(0) : raw(last_i);
+  LOOP_L_N(i, last_i) {
+    const float c0 = cel(i), c1 = cel(i + 1);
+    if (c0 != c1 && (celsius - c0) * (celsius - c1) <= 0) {
+      value = raw(i) + (raw(i + 1) - raw(i)) * (celsius - c0) / (c1 - c0);
+      break;
+    }
+  }
+
+  // Table values are OVERSAMPLENR 10-bit readings. The pin holds 12 bits.
+  return constrain(LROUND(value * 4 / (OVERSAMPLENR)), 0, 0xFFF);
 }
 
 #endif // __PLAT_LINUX__
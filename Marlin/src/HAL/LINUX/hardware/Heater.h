@@ -21,27 +21,97 @@
  */
 #pragma once
 
+#include <atomic>
+#include "../../../inc/MarlinConfig.h"
+#include "../../../module/thermistor/thermistors.h"
 #include "Gpio.h"
+#include "LinearAxis.h"
 
-struct LowpassFilter {
-  uint64_t data_delay = 0;
-  uint16_t update(uint16_t value) {
-    data_delay = data_delay - (data_delay >> 6) + value;
-    return (uint16_t)(data_delay >> 6);
-  }
-};
+/**
+ * Thermal models of the simulated heaters. The defaults are about a 40W
+ * cartridge in an aluminum block and a 220W bed plate of about 220x220mm.
+ * Override any of them with -D in the build flags to model other hardware.
+ */
+#ifndef SIM_AMBIENT
+  #define SIM_AMBIENT               25    // (°C)
+#endif
+#ifndef SIM_HOTEND_POWER
+  #define SIM_HOTEND_POWER          40    // (W)
+#endif
+#ifndef SIM_HOTEND_CAPACITY
+  #define SIM_HOTEND_CAPACITY       16    // (J/K)
+#endif
+#ifndef SIM_HOTEND_LOSS
+  #define SIM_HOTEND_LOSS         0.10    // (W/K)
+#endif
+#ifndef SIM_HOTEND_FAN_LOSS
+  #define SIM_HOTEND_FAN_LOSS     0.05    // (W/K)
+#endif
+#ifndef SIM_HOTEND_FLOW_HEAT
+  #define SIM_HOTEND_FLOW_HEAT  0.0018    // (J/K/mm^3)
+#endif
+#ifndef SIM_HOTEND_SENSOR_LAG
+  #define SIM_HOTEND_SENSOR_LAG    1.0    // (s)
+#endif
+#ifndef SIM_BED_POWER
+  #define SIM_BED_POWER            220    // (W)
+#endif
+#ifndef SIM_BED_CAPACITY
+  #define SIM_BED_CAPACITY         600    // (J/K)
+#endif
+#ifndef SIM_BED_LOSS
+  #define SIM_BED_LOSS             1.2    // (W/K)
+#endif
+#ifndef SIM_BED_SENSOR_LAG
+  #define SIM_BED_SENSOR_LAG       3.0    // (s)
+#endif
 
+/**
+ * Simulated heater, as one lumped thermal mass with a lagging sensor
+ *
+ *   C dT/dt = P * duty - (k + k_fan * fan) * (T - ambient) - c_f * flow * (T - ambient)
+ *   tau dS/dt = T - S
+ *
+ * The heater duty is timed from the pin's edges, so soft PWM at any rate is
+ * seen as its average. The fan is read from its pin (0-255, or on/off) and the
+ * flow from the extruder's steps. The sensor temperature S is turned into an
+ * ADC reading through the configured thermistor table.
+ */
 class Heater: public Peripheral {
 public:
-  Heater(pin_t heater, pin_t adc);
+  typedef struct {
+    float power,            // (W) At full duty
+          capacity,         // (J/K) Heat capacity of the block or plate
+          loss,             // (W/K) To the room, fan off
+          fan_loss,         // (W/K) Added with the part fan at full speed
+          flow_heat,        // (J/K/mm^3) To heat the plastic passing through
+          sensor_lag,       // (s) Time constant of the sensor
+          ambient;          // (°C)
+  } model_t;
+
+  Heater(pin_t heater, pin_t adc, const model_t &model, const temp_entry_t *table, const uint8_t table_len);
   virtual ~Heater();
   void interrupt(GpioEvent ev);
   void update();
 
-  pin_t heater_pin, adc_pin;
-  uint16_t room_temp_raw;
-  uint16_t heater_state;
-  LowpassFilter pwmcap;
-  double heat;
+  void attach_fan(const pin_t pin) { fan_pin = pin; }
+  void attach_extruder(const LinearAxis *axis, const float filament_dia);
+
+  pin_t heater_pin, adc_pin, fan_pin;
+  model_t model;
+  const temp_entry_t *table;
+  uint8_t table_len;
+
+  double temp, sensor;      // (°C) Block and sensor
   uint64_t last;
+
+private:
+  const LinearAxis *extruder;
+  float filament_area;
+  int32_t last_e;
+
+  std::atomic<uint64_t> on_ns, on_since;  // Heater on time, from the pin's edges
+  uint64_t last_on_ns;
+
+  uint16_t adc_value(const float celsius) const;
 };
@@ -23,6 +23,7 @@
 
 #include <chrono>
 #include "Gpio.h"
+#include "StepOracle.h"
 
 class LinearAxis: public Peripheral {
 public:
@@ -30,6 +31,7 @@ public:
   virtual ~LinearAxis();
   void update();
   void interrupt(GpioEvent ev);
+  void attach_oracle(StepOracle *o, const uint8_t axis) { oracle = o; oracle_axis = axis; }
 
   pin_type enable_pin;
   pin_type dir_pin;
@@ -42,4 +44,7 @@ public:
   int32_t max_position;
   uint64_t last_update;
 
+  StepOracle *oracle;
+  uint8_t oracle_axis;
+
 };
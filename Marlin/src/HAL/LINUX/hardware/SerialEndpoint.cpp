@@ -0,0 +1,250 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../../inc/MarlinConfig.h"
+#include "SerialEndpoint.h"
+
+#include <chrono>
+#include <thread>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <termios.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+
+static uint64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+SerialEndpoint::SerialEndpoint(HalSerial &serial)
+  : port(serial), mode(STDIO), in_fd(STDIN_FILENO), out_fd(STDOUT_FILENO), listen_fd(-1), wake_fd(-1),
+    byte_ns(0), latency_ns(0), session_ns(0), rx_bytes(0), tx_bytes(0), rx_lines(0), blocked_ns(0), blocked_since(0) {
+  rx.clear();
+  tx.clear();
+}
+
+bool SerialEndpoint::open(const Mode m, const uint16_t tcp_port/*=0*/) {
+  mode = m;
+  signal(SIGPIPE, SIG_IGN); // A host that goes away is seen as a write error
+
+  wake_fd = eventfd(0, EFD_NONBLOCK);
+  port.data_fd = eventfd(0, EFD_NONBLOCK);
+  if (wake_fd < 0 || port.data_fd < 0) { perror("serial: eventfd"); return false; }
+  port.wake_fd = wake_fd;
+
+  switch (mode) {
+    case STDIO:
+      port.host_connected = true;
+      session_ns = now_ns();
+      break;
+
+    case PTY: {
+      const int fd = posix_openpt(O_RDWR | O_NOCTTY);
+      if (fd < 0 || grantpt(fd) || unlockpt(fd)) { perror("serial: PTY"); return false; }
+      termios tio;
+      tcgetattr(fd, &tio);
+      cfmakeraw(&tio);
+      tcsetattr(fd, TCSANOW, &tio);
+      // The master only reports a hangup once the slave has been opened and closed
+      const int slave = ::open(ptsname(fd), O_RDWR | O_NOCTTY);
+      if (slave >= 0) close(slave);
+      in_fd = out_fd = fd;
+      port.host_connected = false;
+      fprintf(stderr, "serial: PTY at %s\n", ptsname(fd));
+    } break;
+
+    case TCP: {
+      listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+      const int on = 1;
+      setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+      sockaddr_in addr = {};
+      addr.sin_family = AF_INET;
+      addr.sin_port = htons(tcp_port);
+      addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      if (listen_fd < 0 || bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) || listen(listen_fd, 1)) {
+        perror("serial: TCP");
+        return false;
+      }
+      in_fd = out_fd = -1;
+      port.host_connected = false;
+      fprintf(stderr, "serial: listening on 127.0.0.1:%u\n", tcp_port);
+    } break;
+  }
+  return true;
+}
+
+void SerialEndpoint::set_line(const uint32_t baud, const uint32_t latency_us) {
+  byte_ns = baud ? 10000000000ULL / baud : 0; // Start, 8 data and stop bits
+  latency_ns = uint64_t(latency_us) * 1000;
+}
+
+// Wait for a host. False to try again.
+bool SerialEndpoint::connect() {
+  if (mode == PTY) {
+    // The master reports a hangup until something opens the slave
+    pollfd p = { in_fd, POLLIN, 0 };
+    const int r = poll(&p, 1, 100);
+    if (r < 0) return false;
+    if (p.revents & POLLHUP) { std::this_thread::sleep_for(std::chrono::milliseconds(100)); return false; }
+  }
+  else if (mode == TCP) {
+    const int fd = accept(listen_fd, nullptr, nullptr);
+    if (fd < 0) return false;
+    const int on = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    in_fd = out_fd = fd;
+  }
+
+  // Drop output from before the host was there
+  uint8_t c;
+  while (port.transmit_buffer.pop(c)) { /* nada */ }
+  rx.clear();
+  tx.clear();
+  session_ns = now_ns();
+  rx_bytes = tx_bytes = rx_lines = blocked_ns = blocked_since = 0;
+  port.host_connected = true;
+  fprintf(stderr, "serial: host connected\n");
+  return true;
+}
+
+void SerialEndpoint::disconnect() {
+  report(now_ns());
+  switch (mode) {
+    case STDIO: in_fd = -1; break;  // End of input, but keep writing
+    case PTY: port.host_connected = false; break;
+    case TCP: port.host_connected = false; close(in_fd); in_fd = out_fd = -1; break;
+  }
+}
+
+void SerialEndpoint::report(const uint64_t now) {
+  if (blocked_since) blocked_ns += now - blocked_since;
+  blocked_since = 0;
+  const double secs = (now - session_ns) * 1e-9;
+  fprintf(stderr, "serial: %llu lines, %llu bytes in, %llu bytes out in %.2fs (%.0f lines/s), input waited on the firmware %.0f%% of the time\n",
+    (unsigned long long)rx_lines, (unsigned long long)rx_bytes, (unsigned long long)tx_bytes, secs,
+    secs > 0 ? rx_lines / secs : 0.0, secs > 0 ? blocked_ns * 1e-7 / secs : 0.0
+  );
+}
+
+// Put a byte on the line as soon as the wire is free
+void SerialEndpoint::send(Line &line, const uint8_t c, const uint64_t now) {
+  line.wire_ns = _MAX(line.wire_ns, now) + byte_ns;
+  line.flight.emplace_back(line.wire_ns + latency_ns, c);
+}
+
+void SerialEndpoint::run() {
+  // Leave the timer signals (the simulated interrupts) to the firmware thread
+  sigset_t timers;
+  sigemptyset(&timers);
+  sigaddset(&timers, SIGRTMIN);
+  pthread_sigmask(SIG_BLOCK, &timers, nullptr);
+
+  uint8_t buf[256];
+  for (;;) {
+    if (!port.host_connected && !connect()) continue;
+    const uint64_t now = now_ns();
+
+    // Firmware to host: onto the wire as it frees up, and out after the latency
+    uint8_t c;
+    while (tx.wire_ns <= now + HORIZON_NS && port.transmit_buffer.pop(c)) send(tx, c, now);
+    size_t n = 0;
+    while (n < sizeof(buf) && !tx.flight.empty() && tx.flight.front().first <= now) {
+      buf[n++] = tx.flight.front().second;
+      tx.flight.pop_front();
+    }
+    for (size_t done = 0; done < n;) {
+      const ssize_t r = ::write(out_fd, buf + done, n - done);
+      if (r < 0 && errno == EINTR) continue;
+      if (r <= 0) { if (mode != STDIO) disconnect(); break; } // With stdout gone the output is dropped
+      done += r;
+      tx_bytes += r;
+    }
+    if (!port.host_connected) continue;
+
+    // Host to firmware: into the receive buffer once arrived, while there's room
+    const uint64_t had = rx_bytes;
+    while (!rx.flight.empty() && rx.flight.front().first <= now && port.receive_buffer.push(rx.flight.front().second)) {
+      if (rx.flight.front().second == '\n') rx_lines++;
+      rx_bytes++;
+      rx.flight.pop_front();
+    }
+    if (rx_bytes != had) HalSerial::signal(port.want_data, port.data_fd);
+    const bool blocked = !rx.flight.empty() && rx.flight.front().first <= now;
+    if (blocked && !blocked_since) blocked_since = now;
+    if (!blocked && blocked_since) { blocked_ns += now - blocked_since; blocked_since = 0; }
+
+    // Sleep until the next byte is due, or the firmware has something to do with us
+    uint64_t wake_at = UINT64_MAX;
+    if (!tx.flight.empty()) NOMORE(wake_at, tx.flight.front().first);
+    if (!rx.flight.empty() && !blocked) NOMORE(wake_at, rx.flight.front().first);
+    if (tx.wire_ns > now + HORIZON_NS)
+      NOMORE(wake_at, tx.wire_ns - HORIZON_NS);
+    else {
+      port.want_tx = true;
+      if (!port.transmit_buffer.empty()) wake_at = now;
+    }
+    if (blocked) {
+      port.want_rx = true;
+      if (!port.receive_buffer.full()) wake_at = now;
+    }
+
+    // Read from the host while the line can carry more
+    bool can_read = in_fd >= 0 && rx.flight.size() < FLIGHT_MAX;
+    if (can_read && rx.wire_ns > now + HORIZON_NS) {
+      NOMORE(wake_at, rx.wire_ns - HORIZON_NS);
+      can_read = false;
+    }
+
+    pollfd fds[2] = { { wake_fd, POLLIN, 0 }, { can_read ? in_fd : -1, POLLIN, 0 } };
+    timespec timeout = { 0, 0 };
+    if (wake_at != UINT64_MAX) {
+      const uint64_t t = now_ns(), wait = wake_at > t ? wake_at - t : 0;
+      timeout = { time_t(wait / 1000000000ULL), long(wait % 1000000000ULL) };
+    }
+    ppoll(fds, 2, wake_at == UINT64_MAX ? nullptr : &timeout, nullptr);
+    port.want_tx = port.want_rx = false;
+
+    if (fds[0].revents & POLLIN) {
+      uint64_t v;
+      if (::read(wake_fd, &v, sizeof(v)) < 0) { /* nothing pending */ }
+    }
+
+    if (fds[1].revents) {
+      const uint64_t t = now_ns();
+      size_t want = sizeof(buf);
+      if (byte_ns) NOMORE(want, size_t((t + HORIZON_NS - _MIN(_MAX(rx.wire_ns, t), t + HORIZON_NS)) / byte_ns + 1));
+      const ssize_t got = ::read(in_fd, buf, want);
+      if (got > 0)
+        for (ssize_t i = 0; i < got; i++) send(rx, buf[i], t);
+      else if (got == 0 || (errno != EINTR && errno != EAGAIN))
+        disconnect();
+    }
+  }
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,85 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Host end of the simulated serial port
+ *
+ * Connects usb_serial to stdin/stdout, a pseudo-terminal (for host software
+ * that wants a serial device) or a TCP socket on 127.0.0.1 (for print
+ * servers that speak raw TCP). A simulated line can limit the rate to a baud
+ * rate, at 10 bits per byte, and delay each byte by a fixed latency in each
+ * direction.
+ *
+ * One thread does all the I/O. It sleeps in ppoll() on the host side and on
+ * an eventfd that the firmware side signals when it has new output, or
+ * after it frees room in a full receive buffer. New input wakes the firmware
+ * from HAL_idletask() through a second eventfd.
+ *
+ * Each time a host disconnects, the session statistics are printed to stderr:
+ * lines and bytes in each direction, lines per second, and the share of the
+ * time that incoming data waited on a full firmware buffer.
+ */
+
+#include <stdint.h>
+#include <deque>
+#include <utility>
+
+struct HalSerial;
+
+class SerialEndpoint {
+public:
+  enum Mode : uint8_t { STDIO, PTY, TCP };
+
+  SerialEndpoint(HalSerial &port);
+
+  bool open(const Mode mode, const uint16_t tcp_port=0);
+  void set_line(const uint32_t baud, const uint32_t latency_us);
+
+  // The I/O thread. Never returns.
+  void run();
+
+private:
+  // One direction of the simulated line
+  struct Line {
+    uint64_t wire_ns;                                   // The wire is busy until then
+    std::deque<std::pair<uint64_t, uint8_t>> flight;    // Bytes sent, with their arrival times
+    void clear() { wire_ns = 0; flight.clear(); }
+  };
+
+  static constexpr uint64_t HORIZON_NS = 1000000;       // Send bytes this far ahead to batch wakeups
+  static constexpr size_t FLIGHT_MAX = 4096;            // Incoming bytes to hold before pushing back on the host
+
+  HalSerial &port;
+  Mode mode;
+  int in_fd, out_fd, listen_fd, wake_fd;
+  uint64_t byte_ns, latency_ns;
+  Line rx, tx;
+
+  // Session statistics
+  uint64_t session_ns, rx_bytes, tx_bytes, rx_lines, blocked_ns, blocked_since;
+
+  bool connect();
+  void disconnect();
+  void send(Line &line, const uint8_t c, const uint64_t now);
+  void report(const uint64_t now);
+};
@@ -0,0 +1,249 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../../inc/MarlinConfig.h"
+#include "../../../module/planner.h"
+#include "StepOracle.h"
+
+StepOracle::StepOracle(Timer &clock, const char * const summary, const char * const trace_path/*=nullptr*/)
+  : timebase(clock), trace(nullptr), trace_ns(0), summary_path(summary), dirty(false), last_step_ns(0),
+    push_seq(0), next_seq(0), dropped(0) {
+  memset(axes, 0, sizeof(axes));
+  for (auto &s : axes) s.min_dt = UINT64_MAX;
+  if (trace_path) trace = fopen(trace_path, "wb");
+}
+
+StepOracle::~StepOracle() {
+  if (trace) fclose(trace);
+}
+
+static float steps_per_mm(const uint8_t a) { return planner.settings.axis_steps_per_mm[a]; }
+
+// Jerk or junction deviation allowance for a sudden change in an axis's velocity (mm/s)
+static float jump_limit(const uint8_t a) {
+  #if HAS_CLASSIC_JERK
+    #if HAS_LINEAR_E_JERK
+      if (a == E_AXIS) return planner.max_e_jerk[0];
+    #endif
+    return planner.max_jerk[a];
+  #else
+    // At a junction the velocity turns by at most sqrt(8 * accel * deviation)
+    if (TERN0(HAS_LINEAR_E_JERK, a == E_AXIS)) return TERN0(HAS_LINEAR_E_JERK, planner.max_e_jerk[0]);
+    const float accel = _MAX(planner.settings.acceleration, planner.settings.travel_acceleration);
+    return _MAX(SQRT(8 * accel * planner.junction_deviation_mm), float(MINIMUM_PLANNER_SPEED));
+  #endif
+}
+
+// Motor limits are only the planner's axis limits when each motor drives one axis
+static bool check_limits(const uint8_t a) { return a == E_AXIS || ENABLED(IS_FULL_CARTESIAN); }
+
+// Linear Advance moves the extruder ahead of the planned profile on purpose
+static bool check_accel(const uint8_t a) {
+  return check_limits(a) && !(a == E_AXIS && TERN0(LIN_ADVANCE, planner.extruder_advance_K[0] > 0));
+}
+
+void StepOracle::step(const uint8_t a, const bool forward) {
+  if (queue[a].push({ timebase.getScheduledNanos(), push_seq, forward }))
+    push_seq++;
+  else
+    store_release(dropped, uint32_t(dropped + 1));
+}
+
+void StepOracle::check_step(const uint8_t a, const uint64_t t, const bool forward) {
+  axis_t &s = axes[a];
+  const int8_t dir = forward ? 1 : -1;
+
+  if (trace) {
+    if (!trace_ns) {
+      // Header: magic, version, axis count, reserved, steps/mm per axis
+      const uint8_t head[8] = { 'M', 'S', 'T', 'P', 1, AXES, 0, 0 };
+      fwrite(head, 1, sizeof(head), trace);
+      LOOP_L_N(i, AXES) { const float spm = steps_per_mm(i); fwrite(&spm, sizeof(spm), 1, trace); }
+      trace_ns = t;
+    }
+    // Record: nanoseconds since the previous record (LE32), then the axis with the direction in bit 7
+    uint64_t gap = t - trace_ns;
+    for (; gap > UINT32_MAX; gap -= UINT32_MAX) {
+      const uint8_t skip[5] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x7F };
+      fwrite(skip, 1, sizeof(skip), trace);
+    }
+    const uint8_t rec[5] = { uint8_t(gap), uint8_t(gap >> 8), uint8_t(gap >> 16), uint8_t(gap >> 24), uint8_t(a | (forward ? 0x80 : 0)) };
+    fwrite(rec, 1, sizeof(rec), trace);
+    trace_ns = t;
+  }
+
+  s.steps++;
+  s.position += dir;
+  dirty = true;
+  last_step_ns = t;
+
+  // Starting from a stop. The first window is compared with standing still.
+  if (s.moving && t - s.last_ns > STOP_NS) stop(a);
+  if (!s.moving) {
+    s.moving = true;
+    s.have_sample = true;
+    s.last_v = 0;
+    s.last_mid_ns = t;
+    s.dt1 = s.dt2 = 0;
+  }
+  else if (dir != s.dir) {
+    // Reversing: measure the new direction in a new window
+    close_window(a);
+    s.dt1 = s.dt2 = 0;
+  }
+  else if (t > s.last_ns) {
+    // Steps from one ISR (multi-stepping) share a timestamp and count as one event
+    const uint64_t dt = t - s.last_ns;
+    NOMORE(s.min_dt, dt);
+    if (s.dt1 && s.dt2) {
+      // The second difference of the intervals is zero for steady motion and
+      // near zero while accelerating, so what's left is timing error
+      const int64_t d2 = int64_t(dt) - 2 * int64_t(s.dt1) + int64_t(s.dt2);
+      const uint64_t j = d2 < 0 ? -d2 : d2;
+      NOLESS(s.jitter_max, j);
+      s.jitter_sq += double(j) * j;
+      s.jitter_n++;
+    }
+    s.dt2 = s.dt1;
+    s.dt1 = dt;
+  }
+
+  if (!s.window_steps) s.first_ns = t;
+  s.window_steps++;
+  s.last_ns = t;
+  s.dir = dir;
+
+  // Close the window and start the next one on this step
+  if (t - s.first_ns >= WINDOW_NS && s.window_steps >= 3) {
+    close_window(a);
+    s.first_ns = t;
+    s.window_steps = 1;
+  }
+}
+
+// Take a velocity sample from the steps in the current window
+void StepOracle::close_window(const uint8_t a) {
+  axis_t &s = axes[a];
+  if (s.window_steps >= 2 && s.last_ns > s.first_ns) {
+    const float secs = (s.last_ns - s.first_ns) * 1e-9f,
+                rate = (s.window_steps - 1) / secs;
+    NOLESS(s.peak_rate, uint32_t(rate));
+    sample(a, s.dir * rate / steps_per_mm(a), (s.first_ns + s.last_ns) / 2);
+  }
+  s.window_steps = 0;
+}
+
+// The axis has stopped: check the drop to a standstill, one interval after the last step
+void StepOracle::stop(const uint8_t a) {
+  axis_t &s = axes[a];
+  close_window(a);
+  sample(a, 0, s.last_ns + (s.dt1 ? s.dt1 : WINDOW_NS / 2));
+  s.moving = false;
+}
+
+void StepOracle::sample(const uint8_t a, const float v, const uint64_t mid_ns) {
+  axis_t &s = axes[a];
+
+  const float speed = ABS(v), vmax = planner.settings.max_feedrate_mm_s[a];
+  NOLESS(s.peak_v, speed);
+  if (check_limits(a) && speed > vmax * (1 + TOLERANCE) && s.speed_violations++ < REPORT_LIMIT)
+    fprintf(stderr, "step_oracle: %c speed %.2f > %.2f mm/s at %.6fs\n", "XYZE"[a], speed, vmax, mid_ns * 1e-9);
+
+  if (s.have_sample && mid_ns > s.last_mid_ns && check_accel(a)) {
+    // Classic jerk limits each side of a reversal, not the sum
+    const bool reversal = ENABLED(HAS_CLASSIC_JERK) && v * s.last_v < 0;
+    const float dt = (mid_ns - s.last_mid_ns) * 1e-9f,
+                dv = reversal ? _MAX(ABS(v), ABS(s.last_v)) : ABS(v - s.last_v),
+                amax = float(planner.settings.max_acceleration_mm_per_s2[a]),
+                jmax = jump_limit(a),
+                accel = _MAX(0, dv - jmax) / dt,  // Acceleration needed after the allowed jump
+                jump = _MAX(0, dv - amax * dt);   // Jump needed at the allowed acceleration
+    NOLESS(s.peak_a, accel);
+    NOLESS(s.peak_jump, jump);
+    if (dv > (amax * dt + jmax) * (1 + TOLERANCE) && s.accel_violations++ < REPORT_LIMIT)
+      fprintf(stderr, "step_oracle: %c velocity %.2f -> %.2f mm/s in %.3fms exceeds %.0f mm/s2 + %.2f mm/s at %.6fs\n",
+        "XYZE"[a], s.last_v, v, dt * 1e3f, amax, jmax, mid_ns * 1e-9);
+  }
+
+  s.have_sample = true;
+  s.last_v = v;
+  s.last_mid_ns = mid_ns;
+}
+
+void StepOracle::update() {
+  // Take the queued steps in the order they were made. The next one is at the
+  // head of one of the queues, unless it's still being pushed.
+  for (;;) {
+    step_t st = {};
+    uint8_t a = 0;
+    while (a < AXES && !(queue[a].peek(st) && st.seq == next_seq)) a++;
+    if (a == AXES) break;
+    queue[a].pop(st);
+    next_seq++;
+    check_step(a, st.ns, st.forward);
+  }
+
+  if (!dirty || timebase.getScheduledNanos() - last_step_ns < STOP_NS) return;
+  LOOP_L_N(a, AXES) if (axes[a].moving) stop(a);
+  write_summary();
+  if (trace) fflush(trace);
+  dirty = false;
+}
+
+uint32_t StepOracle::finish() {
+  update();
+  LOOP_L_N(a, AXES) if (axes[a].moving) stop(a);
+  write_summary();
+  if (trace) fflush(trace);
+  uint32_t bad = load_acquire(dropped);
+  LOOP_L_N(a, AXES) bad += axes[a].speed_violations + axes[a].accel_violations;
+  return bad;
+}
+
+/**
+ * One line per axis, with measured/limit pairs:
+ *   X steps:16000 position:8000 peak_rate:12000 min_interval:20125ns speed:150.00/150 accel:480.1/500 jump:9.80/10.00 jitter_max:5210ns jitter_rms:830ns violations:0
+ */
+void StepOracle::write_summary() {
+  FILE * const f = fopen(summary_path, "w");
+  if (!f) return;
+  uint32_t violations = 0;
+  LOOP_L_N(a, AXES) {
+    const axis_t &s = axes[a];
+    fprintf(f, "%c steps:%llu position:%d peak_rate:%u min_interval:%lluns speed:%.2f/%.0f accel:%.1f/%.0f jump:%.2f/%.2f jitter_max:%lluns jitter_rms:%.0fns violations:%u\n",
+      "XYZE"[a], (unsigned long long)s.steps, int(s.position), unsigned(s.peak_rate),
+      (unsigned long long)(s.min_dt == UINT64_MAX ? 0 : s.min_dt),
+      s.peak_v, planner.settings.max_feedrate_mm_s[a],
+      s.peak_a, float(planner.settings.max_acceleration_mm_per_s2[a]),
+      s.peak_jump, jump_limit(a),
+      (unsigned long long)s.jitter_max, s.jitter_n ? sqrt(s.jitter_sq / s.jitter_n) : 0.0,
+      unsigned(s.speed_violations + s.accel_violations)
+    );
+    violations += s.speed_violations + s.accel_violations;
+  }
+  fprintf(f, "violations:%u\n", unsigned(violations));
+  if (const uint32_t d = load_acquire(dropped)) fprintf(f, "dropped:%u\n", unsigned(d));
+  fclose(f);
+}
+
+#endif // __PLAT_LINUX__
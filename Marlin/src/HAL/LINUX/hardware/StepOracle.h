@@ -0,0 +1,133 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Step stream oracle for the simulator
+ *
+ * Rebuilds each axis's motion from the timestamps of its step pulses and
+ * checks it against the planner's limits, so a change to the planner or the
+ * Stepper ISR can be checked by running G-code through the simulator.
+ *
+ * Steps are timed by the stepper timer's schedule (the sum of the periods the
+ * ISR asked for) rather than the host clock, which the signal-based timers
+ * can't follow closely. What's measured is the firmware's own timing.
+ *
+ * Velocity is measured over windows of at least WINDOW_NS and 3 steps, so
+ * double/quad stepping and the uneven spacing of an axis that Bresenham
+ * steps on some ISRs only don't look like speed spikes. On a constant
+ * acceleration ramp the mean over a window is the velocity at its middle,
+ * so the windows don't hide a limit being exceeded. Between windows, the
+ * change in velocity may be at most the axis's max acceleration times the
+ * time between them, plus the jerk (or junction deviation) allowance for a
+ * corner. The change beyond what acceleration allows is reported as the "jump".
+ *
+ * step() runs in the firmware thread as each pulse rises. It only stamps the
+ * step and queues it on the axis's lock-free queue. update() in the
+ * simulation thread takes the steps back in the order they were made and
+ * does the checks.
+ *
+ * The summary is written to step_oracle.txt each time motion stops, and by
+ * finish() when the simulator is stopped with SIGINT or SIGTERM. It is a
+ * diagnostic only: the count is printed but the exit status stays 0.
+ * With STEP_ORACLE_TRACE every step is also written to step_trace.bin,
+ * which buildroot/share/scripts/step_trace.py turns into CSV.
+ */
+
+#include <stdio.h>
+#include "Timer.h"
+#include "../../../libs/spsc_queue.h"
+
+class StepOracle {
+public:
+  static constexpr uint8_t AXES = 4;               // X, Y, Z, E0
+  static constexpr uint64_t WINDOW_NS = 10000000;  // Shortest window to measure velocity over
+  static constexpr uint64_t STOP_NS = 100000000;   // A longer gap between steps is a stop
+  static constexpr float TOLERANCE = 0.10f;        // Allowed overshoot of each limit
+  static constexpr uint8_t REPORT_LIMIT = 20;      // Violations to print per axis
+  static constexpr uint16_t QUEUE_SIZE = 4096;     // Steps per axis waiting for update()
+
+  StepOracle(Timer &timebase, const char * const summary_path, const char * const trace_path=nullptr);
+  ~StepOracle();
+
+  // From the step pin, as each pulse rises
+  void step(const uint8_t axis, const bool forward);
+
+  // From the simulation loop. Writes the summary once motion stops.
+  void update();
+
+  // Check the steps still queued, stop all axes and write the summary.
+  // Return the number of violations and dropped steps.
+  uint32_t finish();
+
+private:
+  // A step on its way from the firmware thread to update()
+  struct step_t {
+    uint64_t ns;
+    uint32_t seq;         // Order across the axes
+    bool forward;
+  };
+
+  struct axis_t {
+    bool moving;
+    // Current window
+    uint64_t first_ns, last_ns;
+    uint32_t window_steps;
+    int8_t dir;
+    // Previous velocity sample
+    bool have_sample;
+    float last_v;         // (mm/s) Signed
+    uint64_t last_mid_ns;
+    // Step intervals
+    uint64_t dt1, dt2;    // Last two intervals, for the jitter
+    // Totals
+    uint64_t steps;
+    int32_t position;
+    float peak_v, peak_a, peak_jump;
+    uint32_t peak_rate;   // (steps/s) Over a window
+    uint64_t min_dt;
+    uint64_t jitter_max;
+    double jitter_sq;
+    uint64_t jitter_n;
+    uint32_t speed_violations, accel_violations;
+  };
+
+  axis_t axes[AXES];
+  Timer &timebase;
+  FILE *trace;
+  uint64_t trace_ns;
+  const char *summary_path;
+  bool dirty;
+  uint64_t last_step_ns;
+
+  // Firmware thread to simulation thread
+  SPSCQueue<step_t, QUEUE_SIZE> queue[AXES];
+  uint32_t push_seq,          // Written by step() only
+           next_seq;          // Written by update() only
+  volatile uint32_t dropped;  // Steps that found their queue full
+
+  void check_step(const uint8_t a, const uint64_t t, const bool forward);
+  void sample(const uint8_t a, const float v, const uint64_t mid_ns);
+  void close_window(const uint8_t a);
+  void stop(const uint8_t a);
+  void write_summary();
+};
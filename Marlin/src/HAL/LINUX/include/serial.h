@@ -26,93 +26,74 @@
   #include "../../../feature/e_parser.h"
 #endif
 #include "../../../core/serial_hook.h"
+#include "../../../libs/spsc_queue.h"
 
 #include <stdarg.h>
 #include <stdio.h>
-
-/**
- * Generic RingBuffer
- * T type of the buffer array
- * S size of the buffer (must be power of 2)
- */
-template <typename T, uint32_t S> class RingBuffer {
-public:
-  RingBuffer() { index_read = index_write = 0; }
-  uint32_t available() volatile { return index_write - index_read; }
-  uint32_t free() volatile      { return buffer_size - available(); }
-  bool empty() volatile         { return index_read == index_write; }
-  bool full() volatile          { return available() == buffer_size; }
-  void clear() volatile         { index_read = index_write = 0; }
-
-  bool peek(T *value) volatile {
-    if (value == 0 || available() == 0)
-      return false;
-    *value = buffer[mask(index_read)];
-    return true;
-  }
-
-  int read() volatile {
-    if (empty()) return -1;
-    return buffer[mask(index_read++)];
-  }
-
-  bool write(T value) volatile {
-    if (full()) return false;
-    buffer[mask(index_write++)] = value;
-    return true;
-  }
-
-private:
-  uint32_t mask(uint32_t val) volatile {
-    return buffer_mask & val;
-  }
-
-  static const uint32_t buffer_size = S;
-  static const uint32_t buffer_mask = buffer_size - 1;
-  volatile T buffer[buffer_size];
-  volatile uint32_t index_write;
-  volatile uint32_t index_read;
-};
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 struct HalSerial {
-  HalSerial() { host_connected = true; }
+  HalSerial() : want_tx(false), want_rx(false), want_data(false), wake_fd(-1), data_fd(-1) { host_connected = true; }
 
   void begin(int32_t) {}
   void end()          {}
 
   int peek() {
     uint8_t value;
-    return receive_buffer.peek(&value) ? value : -1;
+    return receive_buffer.peek(value) ? value : -1;
   }
 
-  int read() { return receive_buffer.read(); }
+  int read() {
+    uint8_t value;
+    if (!receive_buffer.pop(value)) return -1;
+    signal(want_rx, wake_fd);
+    return value;
+  }
 
   size_t write(char c) {
     if (!host_connected) return 0;
-    while (!transmit_buffer.free());
-    return transmit_buffer.write(c);
+    while (!transmit_buffer.push(c)) std::this_thread::sleep_for(std::chrono::microseconds(100));
+    signal(want_tx, wake_fd);
+    return 1;
   }
 
   bool connected() { return host_connected; }
 
   uint16_t available() {
-    return (uint16_t)receive_buffer.available();
+    return (uint16_t)receive_buffer.count();
   }
 
   void flush() { receive_buffer.clear(); }
 
-  uint8_t availableForWrite() {
-    return transmit_buffer.free() > 255 ? 255 : (uint8_t)transmit_buffer.free();
-  }
+  uint8_t availableForWrite() { return transmit_buffer.free(); }
 
   void flushTX() {
     if (host_connected)
-      while (transmit_buffer.available()) { /* nada */ }
+      while (!transmit_buffer.empty()) std::this_thread::sleep_for(std::chrono::microseconds(100));
   }
 
-  volatile RingBuffer<uint8_t, 128> receive_buffer;
-  volatile RingBuffer<uint8_t, 128> transmit_buffer;
+  // Filled and drained by the SerialEndpoint thread
+  SPSCQueue<uint8_t, 128> receive_buffer;
+  SPSCQueue<uint8_t, 128> transmit_buffer;
   volatile bool host_connected;
+
+  // The endpoint thread sets a flag before it sleeps waiting for data to
+  // send (want_tx) or for room in the receive buffer (want_rx). The first
+  // write / read after that wakes it through wake_fd. The firmware's idle
+  // task does the same with want_data and data_fd to wait for input.
+  std::atomic<bool> want_tx, want_rx, want_data;
+  int wake_fd, data_fd;
+
+  static void signal(std::atomic<bool> &flag, const int fd) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (flag.load(std::memory_order_relaxed) && flag.exchange(false) && fd >= 0) {
+      const uint64_t one = 1;
+      if (::write(fd, &one, sizeof(one)) < 0) { /* already signalled */ }
+    }
+  }
 };
 
 typedef Serial1Class<HalSerial> MSerialT;
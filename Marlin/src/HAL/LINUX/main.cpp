@@ -23,51 +23,88 @@
 #ifdef __PLAT_LINUX__
 
 //#define GPIO_LOGGING // Full GPIO and Positional Logging
+#if !defined(PRINT_TIME_ESTIMATOR) && !defined(LINUX_SELF_TEST) // These don't step
+  #define STEP_ORACLE        // Check step timing against the planner limits. Summary in step_oracle.txt, also on SIGINT.
+#endif
+//#define STEP_ORACLE_TRACE // Also record every step to step_trace.bin
 
 #include "../../inc/MarlinConfig.h"
 #include "../shared/Delay.h"
 #include "hardware/IOLoggerCSV.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
+#include "hardware/Timer.h"
+#include "hardware/SerialEndpoint.h"
+
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+  #include "estimator.h"
+#elif ENABLED(LINUX_SELF_TEST)
+  #include "selftest.h"
+#endif
 
 #include <stdio.h>
 #include <stdarg.h>
 #include <thread>
 #include <iostream>
 #include <fstream>
-
+#include <getopt.h>
+#include <unistd.h>
+#include <signal.h>
+
+// Thermal models of the simulated heaters. See hardware/Heater.h.
+static constexpr Heater::model_t hotend_model = {
+  SIM_HOTEND_POWER, SIM_HOTEND_CAPACITY, SIM_HOTEND_LOSS, SIM_HOTEND_FAN_LOSS, SIM_HOTEND_FLOW_HEAT, SIM_HOTEND_SENSOR_LAG, SIM_AMBIENT
+}, bed_model = {
+  SIM_BED_POWER, SIM_BED_CAPACITY, SIM_BED_LOSS, 0, 0, SIM_BED_SENSOR_LAG, SIM_AMBIENT   // No part fan or flow
+};
+
+extern Timer timers[];
 extern void setup();
 extern void loop();
 
-// simple stdout / stdin implementation for fake serial port
-void write_serial_thread() {
-  for (;;) {
-    for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--) {
-      fputc(usb_serial.transmit_buffer.read(), stdout);
-    }
-    std::this_thread::yield();
-  }
-}
-
-void read_serial_thread() {
-  char buffer[255] = {};
-  for (;;) {
-    std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
-    if (fgets(buffer, len, stdin))
-      for (std::size_t i = 0; i < strlen(buffer); i++)
-        usb_serial.receive_buffer.write(buffer[i]);
-    std::this_thread::yield();
-  }
-}
+#ifdef STEP_ORACLE
+  // SIGINT / SIGTERM end the run, after the oracle writes its summary
+  static volatile sig_atomic_t stop_requested = 0;
+  static void request_stop(int) { stop_requested = 1; }
+#endif
 
 void simulation_loop() {
-  Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
-  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
   LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
   LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
   LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
   LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
 
+  Heater hotend(HEATER_0_PIN, TEMP_0_PIN, hotend_model,
+    #ifdef TEMPTABLE_0
+      TEMPTABLE_0, TEMPTABLE_0_LEN
+    #else
+      nullptr, 0
+    #endif
+  );
+  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN, bed_model,
+    #ifdef TEMPTABLE_BED
+      TEMPTABLE_BED, TEMPTABLE_BED_LEN
+    #else
+      nullptr, 0
+    #endif
+  );
+  #if PIN_EXISTS(FAN)
+    hotend.attach_fan(FAN_PIN);
+  #endif
+  hotend.attach_extruder(&extruder0, DEFAULT_NOMINAL_FILAMENT_DIA);
+
+  #ifdef STEP_ORACLE
+    StepOracle oracle(timers[STEP_TIMER_NUM], "step_oracle.txt"
+      #ifdef STEP_ORACLE_TRACE
+        , "step_trace.bin"
+      #endif
+    );
+    x_axis.attach_oracle(&oracle, X_AXIS);
+    y_axis.attach_oracle(&oracle, Y_AXIS);
+    z_axis.attach_oracle(&oracle, Z_AXIS);
+    extruder0.attach_oracle(&oracle, E_AXIS);
+  #endif
+
   #ifdef GPIO_LOGGING
     IOLoggerCSV logger("all_gpio_log.csv");
     Gpio::attachLogger(&logger);
@@ -88,6 +125,15 @@ void simulation_loop() {
     z_axis.update();
     extruder0.update();
 
+    #ifdef STEP_ORACLE
+      oracle.update();
+      if (stop_requested) {
+        const uint32_t bad = oracle.finish();
+        if (bad) fprintf(stderr, "step_oracle: %u violation(s) or dropped step(s), see step_oracle.txt\n", unsigned(bad));
+        _exit(0);   // The firmware and serial threads never end
+      }
+    #endif
+
     #ifdef GPIO_LOGGING
       if (x_axis.position != x || y_axis.position != y || z_axis.position != z) {
         uint64_t update = _MAX(x_axis.last_update, y_axis.last_update, z_axis.last_update);
@@ -101,13 +147,61 @@ void simulation_loop() {
       logger.flush();
     #endif
 
-    std::this_thread::yield();
+    // Pin changes reach the peripherals as they happen, so this only keeps the models running
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
   }
 }
 
-int main() {
-  std::thread write_serial (write_serial_thread);
-  std::thread read_serial (read_serial_thread);
+static void usage(const char * const name) {
+  #if ENABLED(PRINT_TIME_ESTIMATOR)
+    fprintf(stderr,
+      "Usage: %s [-o CSV] FILE\n"
+      "  Estimate the print time of a G-code FILE\n"
+      "  -o CSV   Write the time per layer to CSV\n", name);
+    exit(1);
+  #elif ENABLED(LINUX_SELF_TEST)
+    fprintf(stderr,
+      "Usage: %s [TEST...]\n"
+      "  Run the named self tests, or all of them\n", name);
+    exit(1);
+  #endif
+  fprintf(stderr,
+    "Usage: %s [-p | -t PORT] [-b BAUD] [-l US]\n"
+    "  -p       Serial on a pseudo-terminal (the path is printed)\n"
+    "  -t PORT  Serial on TCP 127.0.0.1:PORT\n"
+    "  -b BAUD  Limit the line to BAUD (10 bits per byte)\n"
+    "  -l US    Delay each byte by US microseconds in each direction\n"
+    "With neither -p nor -t the serial port is stdin / stdout.\n", name);
+  exit(1);
+}
+
+int main(int argc, char *argv[]) {
+  SerialEndpoint::Mode mode = SerialEndpoint::STDIO;
+  uint16_t tcp_port = 0;
+  uint32_t baud = 0, latency_us = 0;
+  #if ENABLED(PRINT_TIME_ESTIMATOR)
+    const char *csv_path = nullptr;
+    for (int opt; (opt = getopt(argc, argv, "o:")) != -1;) switch (opt) {
+      case 'o': csv_path = optarg; break;
+      default: usage(argv[0]);
+    }
+    if (optind != argc - 1) usage(argv[0]);
+  #elif ENABLED(LINUX_SELF_TEST)
+    if (getopt(argc, argv, "") != -1) usage(argv[0]);
+  #else
+    for (int opt; (opt = getopt(argc, argv, "pt:b:l:")) != -1;) switch (opt) {
+      case 'p': mode = SerialEndpoint::PTY; break;
+      case 't': mode = SerialEndpoint::TCP; tcp_port = atoi(optarg); break;
+      case 'b': baud = strtoul(optarg, nullptr, 10); break;
+      case 'l': latency_us = strtoul(optarg, nullptr, 10); break;
+      default: usage(argv[0]);
+    }
+  #endif
+
+  SerialEndpoint host(usb_serial);
+  host.set_line(baud, latency_us);
+  if (!host.open(mode, tcp_port)) return 1;
+  std::thread host_serial (&SerialEndpoint::run, &host);
 
   #ifdef MYSERIAL1
     MYSERIAL1.begin(BAUDRATE);
@@ -120,19 +214,36 @@ int main() {
 
   HAL_timer_init();
 
+  #ifdef STEP_ORACLE
+    signal(SIGINT, request_stop);
+    signal(SIGTERM, request_stop);
+  #endif
+
   std::thread simulation (simulation_loop);
 
   DELAY_US(10000);
 
   setup();
+
+  #if ENABLED(PRINT_TIME_ESTIMATOR)
+    const int result = PrintTimeEstimator::run(argv[optind], csv_path);
+    SERIAL_FLUSHTX();
+    fflush(stdout);
+    _exit(result);    // The simulation and serial threads never end
+  #elif ENABLED(LINUX_SELF_TEST)
+    const int result = SelfTest::run(argc - optind, argv + optind);
+    SERIAL_FLUSHTX();
+    fflush(stdout);
+    _exit(result);
+  #endif
+
   for (;;) {
     loop();
     std::this_thread::yield();
   }
 
   simulation.join();
-  write_serial.join();
-  read_serial.join();
+  host_serial.join();
 }
 
 #endif // __PLAT_LINUX__
@@ -0,0 +1,84 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(LINUX_SELF_TEST)
+
+#include "selftest.h"
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+SelfTest *SelfTest::first; // = nullptr
+uint32_t SelfTest::failures; // = 0
+
+SelfTest::SelfTest(const char * const name, const test_fn_t fn) : name(name), fn(fn) {
+  // Keep the tests in name order so the output is the same from build to build
+  SelfTest **p = &first;
+  while (*p && strcmp((*p)->name, name) < 0) p = &(*p)->next;
+  next = *p;
+  *p = this;
+}
+
+int SelfTest::run(const int count, char * const names[]) {
+  int ran = 0, failed = 0;
+  for (SelfTest *t = first; t; t = t->next) {
+    bool wanted = !count;
+    for (int i = 0; !wanted && i < count; i++) wanted = !strcmp(names[i], t->name);
+    if (!wanted) continue;
+    fprintf(stderr, "[ RUN  ] %s\n", t->name);
+    failures = 0;
+    t->fn();
+    fprintf(stderr, "[ %s ] %s\n", failures ? "FAIL" : " OK ", t->name);
+    ran++;
+    if (failures) failed++;
+  }
+  fprintf(stderr, "%i test(s) run, %i failed\n", ran, failed);
+  return ran ? failed : 1;   // Unknown names are a failure too
+}
+
+static void vreport(const char * const fmt, va_list args) {
+  fputs("         ", stderr);
+  vfprintf(stderr, fmt, args);
+  fputc('\n', stderr);
+}
+
+void SelfTest::fail(const char * const fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  vreport(fmt, args);
+  va_end(args);
+  failures++;
+}
+
+void SelfTest::note(const char * const fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  vreport(fmt, args);
+  va_end(args);
+}
+
+#endif // LINUX_SELF_TEST
+#endif // __PLAT_LINUX__
@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Self tests for the LINUX build (env:linux_native_selftest)
+ *
+ * Each test lives in tests/ and registers itself with SELF_TEST(name). The
+ * tests run after setup(), so they see the configured planner, kinematics
+ * and thermistor tables. The program exits with the number of failed tests.
+ */
+
+#include <stdint.h>
+
+class SelfTest {
+public:
+  typedef void (*test_fn_t)();
+
+  SelfTest(const char * const name, const test_fn_t fn);
+
+  // Run the named tests, or all of them if count is 0. Return the number that failed.
+  static int run(const int count, char * const names[]);
+
+  // Fail the running test with a printf-style message
+  static void fail(const char * const fmt, ...) __attribute__((format(printf, 1, 2)));
+
+  // Print a line of detail, such as a measured bound
+  static void note(const char * const fmt, ...) __attribute__((format(printf, 1, 2)));
+
+private:
+  const char * const name;
+  const test_fn_t fn;
+  SelfTest *next;
+
+  static SelfTest *first;
+  static uint32_t failures;   // Of the running test
+};
+
+#define SELF_TEST(NAME) \
+  static void selftest_##NAME(); \
+  static SelfTest selftest_entry_##NAME(#NAME, selftest_##NAME); \
+  static void selftest_##NAME()
+
+#define SELF_CHECK(COND) do{ if (!(COND)) SelfTest::fail("%s:%d: %s", __FILE__, __LINE__, #COND); }while(0)
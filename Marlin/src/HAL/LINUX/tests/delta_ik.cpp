@@ -0,0 +1,96 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include <random>  // Ahead of Arduino.h, whose abs() macro breaks it
+
+#include "../../../inc/MarlinConfig.h"
+
+#if BOTH(LINUX_SELF_TEST, DELTA_INCREMENTAL_IK)
+
+/**
+ * DeltaLineIK against the exact IK, over random straight moves across the
+ * printable area segmented by time, as line_to_destination_kinematic() does,
+ * and then by KINEMATIC_SEGMENT_TOLERANCE if enabled. Each tower height must
+ * stay within a tenth of a step of the exact result. With timed segments most
+ * must take the fast path. The longer tolerance segments resync more often.
+ */
+
+#include "../selftest.h"
+#include "../../../module/delta.h"
+#include "../../../module/motion.h"
+#include "../../../module/planner.h"
+
+static void check_moves(const bool by_tolerance) {
+  std::mt19937 rng(1);  // Fixed seed, so a failure is the same on every run
+  std::uniform_real_distribution<float> unit(0, 1);
+
+  auto random_point = [&]{
+    const float r = (DELTA_PRINTABLE_RADIUS) * SQRT(unit(rng)), a = unit(rng) * float(M_PI) * 2;
+    return xyz_pos_t({ r * cosf(a), r * sinf(a), unit(rng) * 20 });
+  };
+
+  const float tolerance = 0.1f / planner.settings.axis_steps_per_mm[A_AXIS];
+  const uint32_t fast_before = delta_line_ik.fast_segments(), exact_before = delta_line_ik.exact_segments();
+  float worst = 0;
+
+  for (uint16_t m = 0; m < 2000; ++m) {
+    const xyz_pos_t start = random_point(), diff = random_point() - start;
+    const float seconds = diff.magnitude() / (50 + 250 * unit(rng));
+    uint16_t segments = _MAX(1U, uint16_t(segments_per_second * seconds));
+    #ifdef KINEMATIC_SEGMENT_TOLERANCE
+      if (by_tolerance) segments = kinematic_segments(start, diff, segments, seconds);
+    #endif
+    const xyz_float_t segment = diff * (1.0f / segments);
+
+    xyz_pos_t raw = start;
+    delta_line_ik.start(raw, segment, segments - 1);
+    while (--segments) {
+      raw += segment;
+      if (!delta_line_ik.next(raw)) {
+        SelfTest::fail("move %u: next() gave up with %u segments to go", m, segments);
+        break;
+      }
+      const abce_pos_t fast = delta;
+      inverse_kinematics(raw);
+      LOOP_ABC(t) NOLESS(worst, ABS(delta[t] - fast[t]));
+    }
+    delta_line_ik.stop();
+  }
+
+  const uint32_t fast = delta_line_ik.fast_segments() - fast_before,
+                 exact = delta_line_ik.exact_segments() - exact_before;
+  SelfTest::note("%s: %u incremental and %u exact segments, worst difference %.6f mm (limit %.6f)",
+    by_tolerance ? "By tolerance" : "By time", fast, exact, worst, tolerance);
+  if (worst > tolerance) SelfTest::fail("The incremental IK drifted %.6f mm from the exact IK", worst);
+  if (!by_tolerance && fast < exact * 4) SelfTest::fail("Only %u of %u segments took the incremental path", fast, fast + exact);
+}
+
+SELF_TEST(delta_ik) {
+  check_moves(false);
+  #ifdef KINEMATIC_SEGMENT_TOLERANCE
+    check_moves(true);
+  #endif
+}
+
+#endif // LINUX_SELF_TEST && DELTA_INCREMENTAL_IK
+#endif // __PLAT_LINUX__
@@ -0,0 +1,108 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include <random>  // Ahead of Arduino.h, whose abs() macro breaks it
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(LINUX_SELF_TEST) && defined(KINEMATIC_SEGMENT_TOLERANCE) && ENABLED(DELTA)
+
+/**
+ * kinematic_segments() against the real path, over random straight moves
+ * across the printable area. The carriages move linearly between segment
+ * ends, so the effector at the middle of each segment is the forward
+ * kinematics of the mean carriage heights. It must stay within
+ * KINEMATIC_SEGMENT_TOLERANCE of the straight line wherever every rod is
+ * at least 15 degrees from flat. Along a line each rod is flattest at one
+ * end, so only the ends need that check. A longer duration may only add
+ * segments, up to KINEMATIC_SEGMENT_MIN_RATE per second.
+ */
+
+#include "../selftest.h"
+#include "../../../module/delta.h"
+#include "../../../module/motion.h"
+
+SELF_TEST(kinematic_segments) {
+  std::mt19937 rng(1);  // Fixed seed, so a failure is the same on every run
+  std::uniform_real_distribution<float> unit(0, 1);
+
+  auto steep = [](const xyz_pos_t &raw) {
+    LOOP_ABC(t) {
+      const xy_float_t u = delta_tower[t] - raw;
+      if (delta_diagonal_rod_2_tower[t] - HYPOT2(u.x, u.y) < sq(0.2588f) * delta_diagonal_rod_2_tower[t]) return false;  // sin(15)
+    }
+    return true;
+  };
+
+  auto random_point = [&]{
+    for (;;) {
+      const float r = (DELTA_PRINTABLE_RADIUS) * SQRT(unit(rng)), a = unit(rng) * float(M_PI) * 2;
+      const xyz_pos_t p = { r * cosf(a), r * sinf(a), unit(rng) * 20 };
+      if (steep(p)) return p;
+    }
+  };
+
+  auto carriages = [](const xyz_pos_t &raw) {
+    inverse_kinematics(raw);
+    return abc_float_t({ delta.a, delta.b, delta.c });
+  };
+
+  uint32_t total = 0;
+  float worst = 0;
+  for (uint16_t m = 0; m < 2000; ++m) {
+    const xyz_pos_t start = random_point(), diff = random_point() - start;
+    const float mm = diff.magnitude();
+    if (UNEAR_ZERO(mm)) continue;
+    const xyz_float_t dir = diff * (1.0f / mm);
+
+    // As many segments as the tolerance asks for. An instant move gets no rate floor.
+    const uint16_t segments = kinematic_segments(start, diff, 1, 0);
+    const xyz_float_t segment = diff * (1.0f / segments);
+    total += segments;
+
+    // A slow move may only get more
+    const float seconds = 0.1f + 2 * unit(rng);
+    const uint16_t slow = kinematic_segments(start, diff, 1, seconds);
+    if (slow < segments || slow < uint16_t(seconds * (KINEMATIC_SEGMENT_MIN_RATE)))
+      SelfTest::fail("move %u: %u segments over %.3fs, from %u by tolerance", m, slow, seconds, segments);
+
+    xyz_pos_t p = start;
+    abc_float_t q = carriages(p);
+    for (uint16_t s = 0; s < segments; ++s) {
+      const xyz_pos_t p1 = p + segment;
+      const abc_float_t q1 = carriages(p1);
+      forward_kinematics((q + q1) * 0.5f);
+      const xyz_float_t off = cartes - p;
+      const float along = off.x * dir.x + off.y * dir.y + off.z * dir.z;
+      NOLESS(worst, (off - dir * along).magnitude());
+      p = p1;
+      q = q1;
+    }
+  }
+
+  SelfTest::note("%u segments, worst deviation %.6f mm (limit %.6f)", total, worst, float(KINEMATIC_SEGMENT_TOLERANCE));
+  if (worst > (KINEMATIC_SEGMENT_TOLERANCE)) SelfTest::fail("A segment bowed %.6f mm from the line", worst);
+}
+
+#endif // LINUX_SELF_TEST && KINEMATIC_SEGMENT_TOLERANCE && DELTA
+#endif // __PLAT_LINUX__
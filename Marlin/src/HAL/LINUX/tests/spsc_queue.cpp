@@ -0,0 +1,100 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(LINUX_SELF_TEST)
+
+/**
+ * SPSCQueue under a real producer thread. Every item carries its sequence
+ * number and words derived from it, so a lost, repeated, reordered or torn
+ * item shows up at the consumer.
+ */
+
+#include "../selftest.h"
+#include "../../../libs/spsc_queue.h"
+
+#include <atomic>
+#include <thread>
+
+struct item_t { uint32_t seq, a, b, c; };
+
+static item_t make_item(const uint32_t seq) { return { seq, ~seq * 2654435761u, seq ^ 0xA5A5A5A5u, seq * 40503u + 1 }; }
+
+static bool item_ok(const item_t &it) {
+  const item_t want = make_item(it.seq);
+  return it.a == want.a && it.b == want.b && it.c == want.c;
+}
+
+template<uint16_t N>
+static void stress(const uint32_t items) {
+  static SPSCQueue<item_t, N> q;
+  std::atomic<uint32_t> overfull(0);
+
+  std::thread producer([&]{
+    for (uint32_t i = 0; i < items;) {
+      if (q.count() > N) overfull++;
+      if (q.push(make_item(i))) i++; else std::this_thread::yield();
+    }
+  });
+
+  uint32_t expect = 0, lost = 0, torn = 0;
+  while (expect < items) {
+    item_t it, again;
+    // Alternate peek + pop with a plain pop so both paths see traffic
+    if ((expect & 1) && q.peek(it)) {
+      if (!q.pop(again) || again.seq != it.seq) torn++;
+    }
+    else if (!q.pop(it)) { std::this_thread::yield(); continue; }
+    if (it.seq != expect) { lost++; expect = it.seq; }
+    if (!item_ok(it)) torn++;
+    expect++;
+  }
+  producer.join();
+
+  if (lost) SelfTest::fail("N=%u: %u items lost or out of order", N, lost);
+  if (torn) SelfTest::fail("N=%u: %u items torn", N, torn);
+  if (overfull) SelfTest::fail("N=%u: count() exceeded the size %u times", N, overfull.load());
+  if (!q.empty()) SelfTest::fail("N=%u: %u items left over", N, q.count());
+  if (!lost && !torn && !overfull && q.empty()) SelfTest::note("N=%u: %u items passed", N, items);
+}
+
+SELF_TEST(spsc_queue) {
+  // A small queue wraps its 8-bit indexes often and keeps both threads on the full / empty edges
+  stress<8>(2000000);
+  stress<128>(2000000);
+  // A 16-bit index
+  stress<256>(2000000);
+
+  // clear() from the consumer side
+  SPSCQueue<uint8_t, 4> q;
+  for (uint8_t i = 0; i < 4; i++) SELF_CHECK(q.push(i));
+  SELF_CHECK(q.full() && !q.push(4));
+  q.clear();
+  uint8_t v;
+  SELF_CHECK(q.empty() && !q.pop(v) && q.free() == 4);
+  SELF_CHECK(q.push(9) && q.pop(v) && v == 9);
+}
+
+#endif // LINUX_SELF_TEST
+#endif // __PLAT_LINUX__
@@ -0,0 +1,164 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../../inc/MarlinConfig.h"
+
+#if BOTH(LINUX_SELF_TEST, FAST_THERMISTOR_CONVERSION)
+
+/**
+ * The resampled thermistor lookup against the table search it replaces,
+ * at every raw value for every table in module/thermistor. The lookup must
+ * match the search at each whole ADC count, and between counts stay within
+ * the range the search covers over that count.
+ *
+ * Custom thermistors must match the logf() based formula within 0.02°C
+ * from -20°C to 400°C.
+ */
+
+#include "../selftest.h"
+#include "../../../module/temperature.h"
+
+// Every table, not only those in use. A few have no include guard.
+#include "../../../module/thermistor/thermistor_1.h"
+#include "../../../module/thermistor/thermistor_2.h"
+#include "../../../module/thermistor/thermistor_3.h"
+#include "../../../module/thermistor/thermistor_4.h"
+#include "../../../module/thermistor/thermistor_5.h"
+#include "../../../module/thermistor/thermistor_6.h"
+#include "../../../module/thermistor/thermistor_7.h"
+#include "../../../module/thermistor/thermistor_8.h"
+#include "../../../module/thermistor/thermistor_9.h"
+#include "../../../module/thermistor/thermistor_10.h"
+#include "../../../module/thermistor/thermistor_11.h"
+#include "../../../module/thermistor/thermistor_12.h"
+#include "../../../module/thermistor/thermistor_13.h"
+#include "../../../module/thermistor/thermistor_15.h"
+#include "../../../module/thermistor/thermistor_17.h"
+#include "../../../module/thermistor/thermistor_18.h"
+#include "../../../module/thermistor/thermistor_20.h"
+#include "../../../module/thermistor/thermistor_21.h"
+#if !ANY_THERMISTOR_IS(22)
+  #include "../../../module/thermistor/thermistor_22.h"
+#endif
+#if !ANY_THERMISTOR_IS(23)
+  #include "../../../module/thermistor/thermistor_23.h"
+#endif
+#include "../../../module/thermistor/thermistor_30.h"
+#include "../../../module/thermistor/thermistor_51.h"
+#include "../../../module/thermistor/thermistor_52.h"
+#include "../../../module/thermistor/thermistor_55.h"
+#include "../../../module/thermistor/thermistor_60.h"
+#include "../../../module/thermistor/thermistor_61.h"
+#include "../../../module/thermistor/thermistor_66.h"
+#include "../../../module/thermistor/thermistor_67.h"
+#include "../../../module/thermistor/thermistor_70.h"
+#include "../../../module/thermistor/thermistor_71.h"
+#include "../../../module/thermistor/thermistor_75.h"
+#include "../../../module/thermistor/thermistor_99.h"
+#include "../../../module/thermistor/thermistor_110.h"
+#include "../../../module/thermistor/thermistor_147.h"
+#include "../../../module/thermistor/thermistor_201.h"
+#if !ANY_THERMISTOR_IS(202)
+  #include "../../../module/thermistor/thermistor_202.h"
+#endif
+#include "../../../module/thermistor/thermistor_331.h"
+#undef OVM
+#include "../../../module/thermistor/thermistor_332.h"
+#include "../../../module/thermistor/thermistor_501.h"
+#include "../../../module/thermistor/thermistor_502.h"
+#include "../../../module/thermistor/thermistor_503.h"
+#if !ANY_THERMISTOR_IS(512)
+  #include "../../../module/thermistor/thermistor_512.h"
+#endif
+#include "../../../module/thermistor/thermistor_666.h"
+#include "../../../module/thermistor/thermistor_998.h"
+#include "../../../module/thermistor/thermistor_999.h"
+#include "../../../module/thermistor/thermistor_1010.h"
+#include "../../../module/thermistor/thermistor_1047.h"
+#include "../../../module/thermistor/thermistor_2000.h"
+
+constexpr int16_t max_raw = MAX_RAW_THERMISTOR_VALUE;
+
+template<const temp_entry_t *TBL, uint8_t LEN>
+static celsius_float_t scan_table(const int16_t raw) { SCAN_THERMISTOR_TABLE(TBL, LEN); }
+
+template<const temp_entry_t *TBL, uint8_t LEN>
+static celsius_float_t lookup_table(const int16_t raw) { LOOKUP_THERMISTOR_TABLE((thermistor_lookup<TBL, LEN>)); }
+
+template<const temp_entry_t *TBL, uint8_t LEN>
+static void check_table(const uint16_t id) {
+  constexpr float slack = 1.0f / 32 + 0.001f;  // Rounding to 1/16°C, plus float error
+  float worst = 0;
+  int16_t worst_raw = 0;
+  for (int16_t raw = 0; raw <= max_raw; ++raw) {
+    const int16_t lo = raw / (THERMISTOR_LOOKUP_STEP) * (THERMISTOR_LOOKUP_STEP),
+                  hi = _MIN(lo + (THERMISTOR_LOOKUP_STEP), max_raw);
+    const float fast = lookup_table<TBL, LEN>(raw), exact = scan_table<TBL, LEN>(raw),
+                a = scan_table<TBL, LEN>(lo), b = scan_table<TBL, LEN>(hi);
+    if (raw == lo ? ABS(fast - exact) > slack : !WITHIN(fast, _MIN(a, b) - slack, _MAX(a, b) + slack)) {
+      SelfTest::fail("Table %u at raw %i: lookup %.3f, search %.3f", id, raw, fast, exact);
+      return;
+    }
+    if (ABS(fast - exact) > worst) { worst = ABS(fast - exact); worst_raw = raw; }
+  }
+  SelfTest::note("Table %4u: worst difference %.3f°C at raw %i", id, worst, worst_raw);
+}
+
+SELF_TEST(thermistor_lookup) {
+  #define CHECK_TABLE(N) check_table<temptable_##N, COUNT(temptable_##N)>(N)
+  CHECK_TABLE(1);   CHECK_TABLE(2);   CHECK_TABLE(3);    CHECK_TABLE(4);    CHECK_TABLE(5);
+  CHECK_TABLE(6);   CHECK_TABLE(7);   CHECK_TABLE(8);    CHECK_TABLE(9);    CHECK_TABLE(10);
+  CHECK_TABLE(11);  CHECK_TABLE(12);  CHECK_TABLE(13);   CHECK_TABLE(15);   CHECK_TABLE(17);
+  CHECK_TABLE(18);  CHECK_TABLE(20);  CHECK_TABLE(21);   CHECK_TABLE(22);   CHECK_TABLE(23);
+  CHECK_TABLE(30);  CHECK_TABLE(51);  CHECK_TABLE(52);   CHECK_TABLE(55);   CHECK_TABLE(60);
+  CHECK_TABLE(61);  CHECK_TABLE(66);  CHECK_TABLE(67);   CHECK_TABLE(70);   CHECK_TABLE(71);
+  CHECK_TABLE(75);  CHECK_TABLE(99);  CHECK_TABLE(110);  CHECK_TABLE(147);  CHECK_TABLE(201);
+  CHECK_TABLE(202); CHECK_TABLE(331); CHECK_TABLE(332);  CHECK_TABLE(501);  CHECK_TABLE(502);
+  CHECK_TABLE(503); CHECK_TABLE(512); CHECK_TABLE(666);  CHECK_TABLE(998);  CHECK_TABLE(999);
+  CHECK_TABLE(1010); CHECK_TABLE(1047); CHECK_TABLE(2000);
+}
+
+#if HAS_USER_THERMISTORS
+
+  SELF_TEST(thermistor_custom) {
+    LOOP_L_N(i, USER_THERMISTORS) {
+      const user_thermistor_t &t = thermalManager.user_thermistor[i];
+      const double res_25_log = log(double(t.res_25)),
+                   alpha = 1.0 / (THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
+                         - res_25_log / t.beta - t.sh_c_coeff * cu(res_25_log);
+      float worst = 0;
+      for (int16_t raw = 1; raw < max_raw; ++raw) {
+        const double log_r = log(t.series_res * (raw + 0.5) / (max_raw - raw - 0.5)),
+                     exact = 1.0 / (alpha + log_r / t.beta + t.sh_c_coeff * cu(log_r)) + (THERMISTOR_ABS_ZERO_C);
+        if (!WITHIN(exact, -20, 400)) continue;
+        NOLESS(worst, ABS(thermalManager.user_thermistor_to_deg_c(i, raw) - float(exact)));
+      }
+      SelfTest::note("Custom thermistor %u: worst difference %.4f°C", i, worst);
+      if (worst > 0.02f) SelfTest::fail("Custom thermistor %u is off by %.4f°C", i, worst);
+    }
+  }
+
+#endif
+
+#endif // LINUX_SELF_TEST && FAST_THERMISTOR_CONVERSION
+#endif // __PLAT_LINUX__
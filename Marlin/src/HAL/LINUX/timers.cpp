@@ -41,6 +41,9 @@ void HAL_timer_init() {
 }
 
 void HAL_timer_start(const uint8_t timer_num, const uint32_t frequency) {
+  #if ENABLED(PRINT_TIME_ESTIMATOR)
+    if (timer_num == STEP_TIMER_NUM) return;    // Blocks are retired by the estimator, never stepped
+  #endif
   timers[timer_num].start(frequency);
 }
 
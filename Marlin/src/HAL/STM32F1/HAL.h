@@ -265,6 +265,7 @@ void analogWrite(pin_t pin, int pwm_val8); // PWM only! mul by 257 in maple!?
 void flashFirmware(const int16_t);
 
 #define HAL_CAN_SET_PWM_FREQ   // This HAL supports PWM Frequency adjustment
+#define HAL_SDIO_DMA_ASYNC     // sdio.cpp does multi-block and background DMA transfers
 
 /**
  * set_pwm_frequency
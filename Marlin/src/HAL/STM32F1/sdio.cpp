@@ -32,10 +32,18 @@
 
 SDIO_CardInfoTypeDef SdCard;
 
+// A background read started by SDIO_ReadBlocks_Async and finished by SDIO_Wait
+static struct {
+  volatile bool pending;
+  bool result;
+  uint32_t count;
+} sdio_async;
+
 bool SDIO_Init() {
   uint32_t count = 0U;
   SdCard.CardType = SdCard.CardVersion = SdCard.Class = SdCard.RelCardAdd = SdCard.BlockNbr = SdCard.BlockSize = SdCard.LogBlockNbr = SdCard.LogBlockSize = 0;
 
+  sdio_async.pending = false;
   sdio_begin();
   sdio_set_dbus_width(SDIO_CLKCR_WIDBUS_1BIT);
 
@@ -81,28 +89,39 @@ bool SDIO_Init() {
   return true;
 }
 
-bool SDIO_ReadBlock_DMA(uint32_t blockAddress, uint8_t *data) {
+/**
+ * Set up DMA and the data path, then send the read command.
+ * Several blocks are read with READ_MULTIPLE_BLOCK as one DMA transfer.
+ */
+static bool SDIO_StartRead(uint32_t blockAddress, uint8_t *data, const uint32_t count) {
   if (SDIO_GetCardState() != SDIO_CARD_TRANSFER) return false;
-  if (blockAddress >= SdCard.LogBlockNbr) return false;
+  if (blockAddress + count > SdCard.LogBlockNbr) return false;
   if ((0x03 & (uint32_t)data)) return false; // misaligned data
 
   if (SdCard.CardType != CARD_SDHC_SDXC) { blockAddress *= 512U; }
 
   dma_setup_transfer(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, &SDIO->FIFO, DMA_SIZE_32BITS, data, DMA_SIZE_32BITS, DMA_MINC_MODE);
-  dma_set_num_transfers(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, 128);
+  dma_set_num_transfers(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, 128 * count);
   dma_clear_isr_bits(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
   dma_enable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
 
-  sdio_setup_transfer(SDIO_DATA_TIMEOUT * (F_CPU / 1000U), 512, SDIO_BLOCKSIZE_512 | SDIO_DCTRL_DMAEN | SDIO_DCTRL_DTEN | SDIO_DIR_RX);
+  sdio_setup_transfer(SDIO_DATA_TIMEOUT * (F_CPU / 1000U), 512 * count, SDIO_BLOCKSIZE_512 | SDIO_DCTRL_DMAEN | SDIO_DCTRL_DTEN | SDIO_DIR_RX);
 
-  if (!SDIO_CmdReadSingleBlock(blockAddress)) {
+  if (!(count > 1 ? SDIO_CmdReadMultiBlock(blockAddress) : SDIO_CmdReadSingleBlock(blockAddress))) {
     SDIO_CLEAR_FLAG(SDIO_ICR_CMD_FLAGS);
     dma_disable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
     return false;
   }
+  return true;
+}
 
+// Wait for the data started by SDIO_StartRead and check the result
+static bool SDIO_FinishRead(const uint32_t count) {
   while (!SDIO_GET_FLAG(SDIO_STA_DATAEND | SDIO_STA_TRX_ERROR_FLAGS)) { /* wait */ }
 
+  // A multi-block read goes on until it is stopped
+  if (count > 1) (void)SDIO_CmdStopTransmission();
+
   //If there were SDIO errors, do not wait DMA.
   if (SDIO->STA & SDIO_STA_TRX_ERROR_FLAGS) {
     SDIO_CLEAR_FLAG(SDIO_ICR_CMD_FLAGS | SDIO_ICR_DATA_FLAGS);
@@ -135,37 +154,65 @@ bool SDIO_ReadBlock_DMA(uint32_t blockAddress, uint8_t *data) {
   return true;
 }
 
-bool SDIO_ReadBlock(uint32_t blockAddress, uint8_t *data) {
+bool SDIO_ReadBlocks(uint32_t blockAddress, uint8_t *data, const uint32_t count) {
+  SDIO_Wait();
   uint32_t retries = SDIO_READ_RETRIES;
-  while (retries--) if (SDIO_ReadBlock_DMA(blockAddress, data)) return true;
+  while (retries--) if (SDIO_StartRead(blockAddress, data, count) && SDIO_FinishRead(count)) return true;
   return false;
 }
 
+bool SDIO_ReadBlock(uint32_t blockAddress, uint8_t *data) { return SDIO_ReadBlocks(blockAddress, data, 1); }
+
+/**
+ * Start a read and return while DMA fills the buffer. The transfer is
+ * finished by SDIO_Wait(). Any other access waits for it first.
+ */
+bool SDIO_ReadBlocks_Async(uint32_t blockAddress, uint8_t *data, const uint32_t count) {
+  SDIO_Wait();
+  if (!SDIO_StartRead(blockAddress, data, count)) return false;
+  sdio_async.count = count;
+  sdio_async.pending = true;
+  return true;
+}
+
+// Finish any background read and return its result
+bool SDIO_Wait() {
+  if (sdio_async.pending) {
+    sdio_async.result = SDIO_FinishRead(sdio_async.count);
+    sdio_async.pending = false;
+  }
+  return sdio_async.result;
+}
+
 uint32_t millis();
 
-bool SDIO_WriteBlock(uint32_t blockAddress, const uint8_t *data) {
+bool SDIO_WriteBlocks(uint32_t blockAddress, const uint8_t *data, const uint32_t count) {
+  SDIO_Wait();
   if (SDIO_GetCardState() != SDIO_CARD_TRANSFER) return false;
-  if (blockAddress >= SdCard.LogBlockNbr) return false;
+  if (blockAddress + count > SdCard.LogBlockNbr) return false;
   if ((0x03 & (uint32_t)data)) return false; // misaligned data
 
   if (SdCard.CardType != CARD_SDHC_SDXC) { blockAddress *= 512U; }
 
   dma_setup_transfer(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, &SDIO->FIFO, DMA_SIZE_32BITS, (volatile void *) data, DMA_SIZE_32BITS, DMA_MINC_MODE | DMA_FROM_MEM);
-  dma_set_num_transfers(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, 128);
+  dma_set_num_transfers(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, 128 * count);
   dma_clear_isr_bits(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
   dma_enable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
 
-  if (!SDIO_CmdWriteSingleBlock(blockAddress)) {
+  if (!(count > 1 ? SDIO_CmdWriteMultiBlock(blockAddress) : SDIO_CmdWriteSingleBlock(blockAddress))) {
     dma_disable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
     return false;
   }
 
-  sdio_setup_transfer(SDIO_DATA_TIMEOUT * (F_CPU / 1000U), 512U, SDIO_BLOCKSIZE_512 | SDIO_DCTRL_DMAEN | SDIO_DCTRL_DTEN);
+  sdio_setup_transfer(SDIO_DATA_TIMEOUT * (F_CPU / 1000U), 512U * count, SDIO_BLOCKSIZE_512 | SDIO_DCTRL_DMAEN | SDIO_DCTRL_DTEN);
 
   while (!SDIO_GET_FLAG(SDIO_STA_DATAEND | SDIO_STA_TRX_ERROR_FLAGS)) { /* wait */ }
 
   dma_disable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
 
+  // A multi-block write goes on until it is stopped
+  if (count > 1) (void)SDIO_CmdStopTransmission();
+
   if (SDIO_GET_FLAG(SDIO_STA_TRX_ERROR_FLAGS)) {
     SDIO_CLEAR_FLAG(SDIO_ICR_CMD_FLAGS | SDIO_ICR_DATA_FLAGS);
     return false;
@@ -182,6 +229,8 @@ bool SDIO_WriteBlock(uint32_t blockAddress, const uint8_t *data) {
   return false;
 }
 
+bool SDIO_WriteBlock(uint32_t blockAddress, const uint8_t *data) { return SDIO_WriteBlocks(blockAddress, data, 1); }
+
 inline uint32_t SDIO_GetCardState() { return SDIO_CmdSendStatus(SdCard.RelCardAdd << 16U) ? (SDIO_GetResponse(SDIO_RESP1) >> 9U) & 0x0FU : SDIO_CARD_ERROR; }
 
 // No F1 board with SDIO + MSC using Maple, that I aware of...
@@ -205,6 +254,9 @@ bool SDIO_CmdSendCSD(uint32_t argument) { SDIO_SendCommand(CMD9_SEND_CSD, argume
 bool SDIO_CmdSendStatus(uint32_t argument) { SDIO_SendCommand(CMD13_SEND_STATUS, argument); return SDIO_GetCmdResp1(SDMMC_CMD_SEND_STATUS); }
 bool SDIO_CmdReadSingleBlock(uint32_t address) { SDIO_SendCommand(CMD17_READ_SINGLE_BLOCK, address); return SDIO_GetCmdResp1(SDMMC_CMD_READ_SINGLE_BLOCK); }
 bool SDIO_CmdWriteSingleBlock(uint32_t address) { SDIO_SendCommand(CMD24_WRITE_SINGLE_BLOCK, address); return SDIO_GetCmdResp1(SDMMC_CMD_WRITE_SINGLE_BLOCK); }
+bool SDIO_CmdStopTransmission() { SDIO_SendCommand(CMD12_STOP_TRANSMISSION, 0); return SDIO_GetCmdResp1(SDMMC_CMD_STOP_TRANSMISSION); }
+bool SDIO_CmdReadMultiBlock(uint32_t address) { SDIO_SendCommand(CMD18_READ_MULT_BLOCK, address); return SDIO_GetCmdResp1(SDMMC_CMD_READ_MULT_BLOCK); }
+bool SDIO_CmdWriteMultiBlock(uint32_t address) { SDIO_SendCommand(CMD25_WRITE_MULT_BLOCK, address); return SDIO_GetCmdResp1(SDMMC_CMD_WRITE_MULT_BLOCK); }
 bool SDIO_CmdAppCommand(uint32_t rsa) { SDIO_SendCommand(CMD55_APP_CMD, rsa); return SDIO_GetCmdResp1(SDMMC_CMD_APP_CMD); }
 
 bool SDIO_CmdAppSetBusWidth(uint32_t rsa, uint32_t argument) {
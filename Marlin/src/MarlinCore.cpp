@@ -186,6 +186,26 @@
   #include "feature/cancel_object.h"
 #endif
 
+#if ENABLED(BINARY_TELEMETRY)
+  #include "feature/binary_telemetry.h"
+#endif
+
+#if ENABLED(CRITICAL_SECTION_TRACE)
+  #include "feature/critical_trace.h"
+#endif
+
+#if ENABLED(EVENT_TRACE)
+  #include "feature/event_trace.h"
+#endif
+
+#if ENABLED(PLANNER_STARVATION_MONITOR)
+  #include "feature/planner_monitor.h"
+#endif
+
+#if ENABLED(REMAINING_TIME_ESTIMATE)
+  #include "feature/time_estimate.h"
+#endif
+
 #if HAS_FILAMENT_SENSOR
   #include "feature/runout.h"
 #endif
@@ -828,10 +848,15 @@ void idle(bool no_stepper_sleep/*=false*/) {
       TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
       TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
       TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
+      TERN_(BINARY_TELEMETRY, telemetry.tick());
       TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
+      TERN_(PLANNER_STARVATION_MONITOR, planner_monitor.auto_reporter.tick());
     }
   #endif
 
+  TERN_(PLANNER_STARVATION_MONITOR, planner_monitor.update());
+  TERN_(REMAINING_TIME_ESTIMATE, time_estimate.update());
+
   // Update the Průša MMU2
   TERN_(HAS_PRUSA_MMU2, mmu2.mmu_loop());
 
@@ -1178,6 +1203,9 @@ void setup() {
 
   SETUP_RUN(HAL_init());
 
+  TERN_(CRITICAL_SECTION_TRACE, critical_trace.init());
+  TERN_(EVENT_TRACE, event_trace.init());
+
   // Init and disable SPI thermocouples; this is still needed
   #if TEMP_SENSOR_0_IS_MAX_TC || (TEMP_SENSOR_REDUNDANT_IS_MAX_TC && REDUNDANT_TEMP_MATCH(SOURCE, E0))
     OUT_WRITE(TEMP_0_CS_PIN, HIGH);  // Disable
@@ -1246,7 +1274,8 @@ void setup() {
     );
   #endif
   SERIAL_ECHO_MSG(" Compiled: " __DATE__);
-  SERIAL_ECHO_MSG(STR_FREE_MEMORY, freeMemory(), STR_PLANNER_BUFFER_BYTES, sizeof(block_t) * (BLOCK_BUFFER_SIZE));
+  SERIAL_ECHO_MSG(STR_FREE_MEMORY, freeMemory(), STR_PLANNER_BUFFER_BYTES, sizeof(block_t) * (BLOCK_BUFFER_SIZE),
+    " (", BLOCK_BUFFER_SIZE, " x ", sizeof(block_t), ")");
 
   // Some HAL need precise delay adjustment
   calibrate_delay_loop();
@@ -281,6 +281,7 @@
 #define STR_HOTEND_PID                      "Hotend PID"
 #define STR_BED_PID                         "Bed PID"
 #define STR_CHAMBER_PID                     "Chamber PID"
+#define STR_MODEL_PREDICTIVE_CONTROL        "Model predictive control"
 #define STR_STEPS_PER_UNIT                  "Steps per unit"
 #define STR_LINEAR_ADVANCE                  "Linear Advance"
 #define STR_CONTROLLER_FAN                  "Controller Fan"
@@ -145,8 +145,6 @@ void print_bilinear_leveling_grid() {
 
   #define ABL_GRID_POINTS_VIRT_X GRID_MAX_CELLS_X * (BILINEAR_SUBDIVISIONS) + 1
   #define ABL_GRID_POINTS_VIRT_Y GRID_MAX_CELLS_Y * (BILINEAR_SUBDIVISIONS) + 1
-  #define ABL_TEMP_POINTS_X (GRID_MAX_POINTS_X + 2)
-  #define ABL_TEMP_POINTS_Y (GRID_MAX_POINTS_Y + 2)
   float z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
   xy_pos_t bilinear_grid_spacing_virt;
   xy_float_t bilinear_grid_factor_virt;
@@ -158,89 +156,10 @@ void print_bilinear_leveling_grid() {
     );
   }
 
-  #define LINEAR_EXTRAPOLATION(E, I) ((E) * 2 - (I))
-  float bed_level_virt_coord(const uint8_t x, const uint8_t y) {
-    uint8_t ep = 0, ip = 1;
-    if (x > (GRID_MAX_POINTS_X) + 1 || y > (GRID_MAX_POINTS_Y) + 1) {
-      // The requested point requires extrapolating two points beyond the mesh.
-      // These values are only requested for the edges of the mesh, which are always an actual mesh point,
-      // and do not require interpolation. When interpolation is not needed, this "Mesh + 2" point is
-      // cancelled out in bed_level_virt_cmr and does not impact the result. Return 0.0 rather than
-      // making this function more complex by extrapolating two points.
-      return 0.0;
-    }
-    if (!x || x == ABL_TEMP_POINTS_X - 1) {
-      if (x) {
-        ep = (GRID_MAX_POINTS_X) - 1;
-        ip = GRID_MAX_CELLS_X - 1;
-      }
-      if (WITHIN(y, 1, ABL_TEMP_POINTS_Y - 2))
-        return LINEAR_EXTRAPOLATION(
-          z_values[ep][y - 1],
-          z_values[ip][y - 1]
-        );
-      else
-        return LINEAR_EXTRAPOLATION(
-          bed_level_virt_coord(ep + 1, y),
-          bed_level_virt_coord(ip + 1, y)
-        );
-    }
-    if (!y || y == ABL_TEMP_POINTS_Y - 1) {
-      if (y) {
-        ep = (GRID_MAX_POINTS_Y) - 1;
-        ip = GRID_MAX_CELLS_Y - 1;
-      }
-      if (WITHIN(x, 1, ABL_TEMP_POINTS_X - 2))
-        return LINEAR_EXTRAPOLATION(
-          z_values[x - 1][ep],
-          z_values[x - 1][ip]
-        );
-      else
-        return LINEAR_EXTRAPOLATION(
-          bed_level_virt_coord(x, ep + 1),
-          bed_level_virt_coord(x, ip + 1)
-        );
-    }
-    return z_values[x - 1][y - 1];
-  }
-
-  static float bed_level_virt_cmr(const float p[4], const uint8_t i, const float t) {
-    return (
-        p[i-1] * -t * sq(1 - t)
-      + p[i]   * (2 - 5 * sq(t) + 3 * t * sq(t))
-      + p[i+1] * t * (1 + 4 * t - 3 * sq(t))
-      - p[i+2] * sq(t) * (1 - t)
-    ) * 0.5f;
-  }
-
-  static float bed_level_virt_2cmr(const uint8_t x, const uint8_t y, const_float_t tx, const_float_t ty) {
-    float row[4], column[4];
-    LOOP_L_N(i, 4) {
-      LOOP_L_N(j, 4) {
-        column[j] = bed_level_virt_coord(i + x - 1, j + y - 1);
-      }
-      row[i] = bed_level_virt_cmr(column, 1, ty);
-    }
-    return bed_level_virt_cmr(row, 1, tx);
-  }
-
   void bed_level_virt_interpolate() {
     bilinear_grid_spacing_virt = bilinear_grid_spacing / (BILINEAR_SUBDIVISIONS);
     bilinear_grid_factor_virt = bilinear_grid_spacing_virt.reciprocal();
-    LOOP_L_N(y, GRID_MAX_POINTS_Y)
-      LOOP_L_N(x, GRID_MAX_POINTS_X)
-        LOOP_L_N(ty, BILINEAR_SUBDIVISIONS)
-          LOOP_L_N(tx, BILINEAR_SUBDIVISIONS) {
-            if ((ty && y == (GRID_MAX_POINTS_Y) - 1) || (tx && x == (GRID_MAX_POINTS_X) - 1))
-              continue;
-            z_values_virt[x * (BILINEAR_SUBDIVISIONS) + tx][y * (BILINEAR_SUBDIVISIONS) + ty] =
-              bed_level_virt_2cmr(
-                x + 1,
-                y + 1,
-                (float)tx / (BILINEAR_SUBDIVISIONS),
-                (float)ty / (BILINEAR_SUBDIVISIONS)
-              );
-          }
+    mesh_subdivide_cmr(&z_values_virt[0][0], &z_values[0][0], GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, BILINEAR_SUBDIVISIONS);
   }
 #endif // ABL_BILINEAR_SUBDIVISION
 
@@ -131,10 +131,10 @@ void reset_bed_level() {
     #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
       bilinear_start.reset();
       bilinear_grid_spacing.reset();
-      GRID_LOOP(x, y) {
-        z_values[x][y] = NAN;
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, 0));
-      }
+      mesh_fill(z_values, NAN);
+      #if ENABLED(EXTENSIBLE_UI)
+        GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, 0);
+      #endif
     #elif ABL_PLANAR
       planner.bed_level_matrix.set_to_identity();
     #endif
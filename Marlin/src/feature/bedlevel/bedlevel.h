@@ -61,6 +61,8 @@ class TemporaryBedLevelingState {
 
   typedef float bed_mesh_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 
+  #include "mesh_math.h"
+
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
     #include "abl/abl.h"
   #elif ENABLED(AUTO_BED_LEVELING_UBL)
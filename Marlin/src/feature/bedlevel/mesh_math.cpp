@@ -0,0 +1,180 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * mesh_math.cpp - Operations on bed leveling meshes
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if HAS_MESH
+
+#include "bedlevel.h"
+
+#if NEED_LSF
+  #include "../../libs/least_squares_fit.h"
+  #include "../../MarlinCore.h"
+#endif
+
+void mesh_fill(float *z, uint16_t n, const_float_t v) {
+  for (; n >= 4; n -= 4, z += 4) { z[0] = v; z[1] = v; z[2] = v; z[3] = v; }
+  while (n--) *z++ = v;
+}
+
+uint16_t mesh_fill_invalid(float *z, const uint16_t n, const_float_t v) {
+  uint16_t filled = 0;
+  for (uint16_t i = 0; i < n; i++)
+    if (isnan(z[i])) { z[i] = v; filled++; }
+  return filled;
+}
+
+// Invalid points stay NAN
+void mesh_offset(float *z, uint16_t n, const_float_t v) {
+  for (; n >= 4; n -= 4, z += 4) { z[0] += v; z[1] += v; z[2] += v; z[3] += v; }
+  while (n--) *z++ += v;
+}
+
+void mesh_subtract(float * __restrict z, const float * __restrict ref, uint16_t n) {
+  for (; n >= 4; n -= 4, z += 4, ref += 4) {
+    z[0] -= ref[0]; z[1] -= ref[1]; z[2] -= ref[2]; z[3] -= ref[3];
+  }
+  while (n--) *z++ -= *ref++;
+}
+
+void mesh_stats(mesh_stats_t &st, const float *z, const uint16_t n) {
+  uint16_t count = 0;
+  float sum = 0, lo = __FLT_MAX__, hi = -__FLT_MAX__;
+  for (uint16_t i = 0; i < n; i++) {
+    const float v = z[i];
+    if (isnan(v)) continue;
+    sum += v;
+    NOMORE(lo, v);
+    NOLESS(hi, v);
+    count++;
+  }
+
+  const float mean = sum / count;
+  float sum_sq = 0;
+  for (uint16_t i = 0; i < n; i++)
+    if (!isnan(z[i])) sum_sq += sq(z[i] - mean);
+
+  st.count = count;
+  st.mean = mean;
+  st.sum_sq = sum_sq;
+  st.lo = lo;
+  st.hi = hi;
+}
+
+#if NEED_LSF
+
+  bool mesh_fill_wlsf(bed_mesh_t &z, const xy_pos_t &origin, const xy_pos_t &spacing, const_float_t weight) {
+    static_assert((GRID_MAX_POINTS_Y) <= 16, "GRID_MAX_POINTS_Y too big");
+    uint16_t valid[GRID_MAX_POINTS_X] = { 0 };
+    GRID_LOOP(x, y) if (!isnan(z[x][y])) SBI(valid[x], y);
+
+    // The weights only depend on the distance in whole cells
+    float wt[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+    GRID_LOOP(dx, dy) wt[dx][dy] = 1.0f + weight / HYPOT(dx * spacing.x, dy * spacing.y);
+
+    float xpos[GRID_MAX_POINTS_X], ypos[GRID_MAX_POINTS_Y];
+    LOOP_L_N(i, GRID_MAX_POINTS_X) xpos[i] = origin.x + i * spacing.x;
+    LOOP_L_N(i, GRID_MAX_POINTS_Y) ypos[i] = origin.y + i * spacing.y;
+
+    struct linear_fit_data lsf;
+    GRID_LOOP(ix, iy) {
+      if (TEST(valid[ix], iy)) continue;
+      incremental_LSF_reset(&lsf);
+      LOOP_L_N(jx, GRID_MAX_POINTS_X) {
+        if (!valid[jx]) continue;
+        const float * const wrow = wt[ABS(jx - ix)];
+        LOOP_L_N(jy, GRID_MAX_POINTS_Y)
+          if (TEST(valid[jx], jy))
+            incremental_WLSF(&lsf, xpos[jx], ypos[jy], z[jx][jy], wrow[ABS(jy - iy)]);
+      }
+      if (finish_incremental_LSF(&lsf)) return false;
+      z[ix][iy] = -lsf.D - lsf.A * xpos[ix] - lsf.B * ypos[iy];
+      idle(); // housekeeping
+    }
+    return true;
+  }
+
+#endif // NEED_LSF
+
+// Catmull-Rom weights of the four points around a cell at 't' along it
+static void cmr_weights(float w[4], const_float_t t) {
+  const float t2 = sq(t), t3 = t2 * t;
+  w[0] = (2 * t2 - t - t3) * 0.5f;
+  w[1] = (2 - 5 * t2 + 3 * t3) * 0.5f;
+  w[2] = (t + 4 * t2 - 3 * t3) * 0.5f;
+  w[3] = (t3 - t2) * 0.5f;
+}
+
+/**
+ * The points and weights for cell 'k' of a line of 'n' points. Past either
+ * end the line continues linearly (2 * end - next), which folds into the
+ * weights of the end points.
+ */
+static void cmr_span(uint8_t ind[4], float f[4], const float w[4], const uint8_t k, const uint8_t n) {
+  LOOP_L_N(i, 4) { ind[i] = k + i - 1; f[i] = w[i]; }
+  if (k == 0)     { f[1] += 2 * f[0]; f[2] -= f[0]; f[0] = 0; ind[0] = 0; }
+  if (k + 2 >= n) { f[2] += 2 * f[3]; f[1] -= f[3]; f[3] = 0; ind[3] = n - 1; }
+}
+
+void mesh_subdivide_cmr(float * __restrict dst, const float * __restrict src, const uint8_t nx, const uint8_t ny, const uint8_t sub) {
+  const uint16_t vy = (ny - 1) * sub + 1;   // Points in a subdivided row
+  float w[4], f[4];
+  uint8_t ind[4];
+
+  // Subdivide along Y the rows that hold mesh points
+  LOOP_L_N(x, nx) {
+    const float * const p = src + x * ny;
+    float * const r = dst + uint16_t(x * sub) * vy;
+    LOOP_L_N(k, ny) r[k * sub] = p[k];
+    for (uint8_t t = 1; t < sub; t++) {
+      cmr_weights(w, float(t) / sub);
+      for (uint8_t k = 1; k + 2 < ny; k++)
+        r[k * sub + t] = w[0] * p[k - 1] + w[1] * p[k] + w[2] * p[k + 1] + w[3] * p[k + 2];
+      // The first and last cells reach past the edges
+      auto edge = [&](const uint8_t k) {
+        cmr_span(ind, f, w, k, ny);
+        r[k * sub + t] = f[0] * p[ind[0]] + f[1] * p[ind[1]] + f[2] * p[ind[2]] + f[3] * p[ind[3]];
+      };
+      edge(0);
+      if (ny > 2) edge(ny - 2);
+    }
+  }
+
+  // Subdivide along X between those rows
+  for (uint8_t t = 1; t < sub; t++) {
+    cmr_weights(w, float(t) / sub);
+    LOOP_L_N(k, nx - 1) {
+      cmr_span(ind, f, w, k, nx);
+      const float * const r0 = dst + uint16_t(ind[0] * sub) * vy, * const r1 = dst + uint16_t(ind[1] * sub) * vy,
+                  * const r2 = dst + uint16_t(ind[2] * sub) * vy, * const r3 = dst + uint16_t(ind[3] * sub) * vy;
+      float * __restrict const r = dst + uint16_t(k * sub + t) * vy;
+      for (uint16_t j = 0; j < vy; j++)
+        r[j] = f[0] * r0[j] + f[1] * r1[j] + f[2] * r2[j] + f[3] * r3[j];
+    }
+  }
+}
+
+#endif // HAS_MESH
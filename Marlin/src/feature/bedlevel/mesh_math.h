@@ -0,0 +1,68 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * mesh_math.h - Operations on bed leveling meshes
+ *
+ * A mesh of nx * ny points is stored as one contiguous array with a row of
+ * ny values for each X index, the layout of bed_mesh_t. Unprobed points are
+ * NAN. The kernels walk that storage linearly so they stay in tight loops
+ * on the FPU of 32-bit boards and vectorize on the native build.
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+struct mesh_stats_t {
+  uint16_t count;   // Valid (not NAN) points
+  float mean,       // Mean of the valid points
+        sum_sq,     // Sum of the squared differences from the mean
+        lo, hi;     // Lowest and highest valid points
+};
+
+void mesh_fill(float *z, const uint16_t n, const_float_t v);
+uint16_t mesh_fill_invalid(float *z, const uint16_t n, const_float_t v);
+void mesh_offset(float *z, const uint16_t n, const_float_t v);
+void mesh_subtract(float * __restrict z, const float * __restrict ref, const uint16_t n);
+void mesh_stats(mesh_stats_t &st, const float *z, const uint16_t n);
+
+inline void mesh_fill(bed_mesh_t &z, const_float_t v) { mesh_fill(&z[0][0], GRID_MAX_POINTS, v); }
+inline uint16_t mesh_fill_invalid(bed_mesh_t &z, const_float_t v) { return mesh_fill_invalid(&z[0][0], GRID_MAX_POINTS, v); }
+inline void mesh_offset(bed_mesh_t &z, const_float_t v) { mesh_offset(&z[0][0], GRID_MAX_POINTS, v); }
+inline void mesh_subtract(bed_mesh_t &z, const bed_mesh_t &ref) { mesh_subtract(&z[0][0], &ref[0][0], GRID_MAX_POINTS); }
+inline void mesh_stats(mesh_stats_t &st, const bed_mesh_t &z) { mesh_stats(st, &z[0][0], GRID_MAX_POINTS); }
+
+#if NEED_LSF
+  /**
+   * Fill each invalid point of an evenly spaced mesh from a least squares plane
+   * fit to the originally valid points, each weighted by 1 + weight / distance
+   * so nearby points have the most influence. Return false if a fit fails.
+   */
+  bool mesh_fill_wlsf(bed_mesh_t &z, const xy_pos_t &origin, const xy_pos_t &spacing, const_float_t weight);
+#endif
+
+/**
+ * Subdivide each cell of a mesh into sub x sub cells with bicubic Catmull-Rom
+ * interpolation, extending the mesh linearly past its edges. The destination
+ * holds ((nx - 1) * sub + 1) * ((ny - 1) * sub + 1) values.
+ */
+void mesh_subdivide_cmr(float * __restrict dst, const float * __restrict src, const uint8_t nx, const uint8_t ny, const uint8_t sub);
@@ -104,10 +104,10 @@ void unified_bed_leveling::invalidate() {
 }
 
 void unified_bed_leveling::set_all_mesh_points_to_value(const_float_t value) {
-  GRID_LOOP(x, y) {
-    z_values[x][y] = value;
-    TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, value));
-  }
+  mesh_fill(z_values, value);
+  #if ENABLED(EXTENSIBLE_UI)
+    GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, value);
+  #endif
 }
 
 #if ENABLED(OPTIMIZED_MESH_STORAGE)
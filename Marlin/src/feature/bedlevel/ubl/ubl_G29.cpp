@@ -516,7 +516,7 @@ void unified_bed_leveling::G29() {
               if (cpos.x < 0) {
                 // No more REAL INVALID mesh points to populate, so we ASSUME
                 // user meant to populate ALL INVALID mesh points to value
-                GRID_LOOP(x, y) if (isnan(z_values[x][y])) z_values[x][y] = param.C_constant;
+                mesh_fill_invalid(z_values, param.C_constant);
                 break; // No more invalid Mesh Points to populate
               }
               else {
@@ -672,47 +672,31 @@ void unified_bed_leveling::G29() {
  *                   Find the mean average and shift the mesh to center on that value.
  */
 void unified_bed_leveling::adjust_mesh_to_mean(const bool cflag, const_float_t offset) {
-  float sum = 0;
-  uint8_t n = 0;
-  GRID_LOOP(x, y)
-    if (!isnan(z_values[x][y])) {
-      sum += z_values[x][y];
-      n++;
-    }
-
-  const float mean = sum / n;
+  mesh_stats_t st;
+  mesh_stats(st, z_values);
 
-  //
-  // Sum the squares of difference from mean
-  //
-  float sum_of_diff_squared = 0;
-  GRID_LOOP(x, y)
-    if (!isnan(z_values[x][y]))
-      sum_of_diff_squared += sq(z_values[x][y] - mean);
+  SERIAL_ECHOLNPGM("# of samples: ", st.count);
+  SERIAL_ECHOLNPAIR_F("Mean Mesh Height: ", st.mean, 6);
 
-  SERIAL_ECHOLNPGM("# of samples: ", n);
-  SERIAL_ECHOLNPAIR_F("Mean Mesh Height: ", mean, 6);
-
-  const float sigma = SQRT(sum_of_diff_squared / (n + 1));
+  const float sigma = SQRT(st.sum_sq / (st.count + 1));
   SERIAL_ECHOLNPAIR_F("Standard Deviation: ", sigma, 6);
 
-  if (cflag)
-    GRID_LOOP(x, y)
-      if (!isnan(z_values[x][y])) {
-        z_values[x][y] -= mean + offset;
-        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
-      }
+  if (cflag) {
+    mesh_offset(z_values, -(st.mean + offset));
+    #if ENABLED(EXTENSIBLE_UI)
+      GRID_LOOP(x, y) if (!isnan(z_values[x][y])) ExtUI::onMeshUpdate(x, y, z_values[x][y]);
+    #endif
+  }
 }
 
 /**
  * G29 P6 C<offset> : Shift Mesh Height by a uniform constant.
  */
 void unified_bed_leveling::shift_mesh_height() {
-  GRID_LOOP(x, y)
-    if (!isnan(z_values[x][y])) {
-      z_values[x][y] += param.C_constant;
-      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
-    }
+  mesh_offset(z_values, param.C_constant);
+  #if ENABLED(EXTENSIBLE_UI)
+    GRID_LOOP(x, y) if (!isnan(z_values[x][y])) ExtUI::onMeshUpdate(x, y, z_values[x][y]);
+  #endif
 }
 
 #if HAS_BED_PROBE
@@ -1666,45 +1650,23 @@ void unified_bed_leveling::smart_fill_mesh() {
     // the point being extrapolated.  Then extrapolate the mesh point from WLSF.
 
     static_assert((GRID_MAX_POINTS_Y) <= 16, "GRID_MAX_POINTS_Y too big");
-    uint16_t bitmap[GRID_MAX_POINTS_X] = { 0 };
-    struct linear_fit_data lsf_results;
+    #if ENABLED(EXTENSIBLE_UI)
+      uint16_t bitmap[GRID_MAX_POINTS_X] = { 0 };
+      GRID_LOOP(jx, jy) if (isnan(z_values[jx][jy])) SBI(bitmap[jx], jy);
+    #endif
 
     SERIAL_ECHOPGM("Extrapolating mesh...");
 
     const float weight_scaled = weight_factor * _MAX(MESH_X_DIST, MESH_Y_DIST);
+    const bool done = mesh_fill_wlsf(z_values, { MESH_MIN_X, MESH_MIN_Y }, { MESH_X_DIST, MESH_Y_DIST }, weight_scaled);
 
-    GRID_LOOP(jx, jy) if (!isnan(z_values[jx][jy])) SBI(bitmap[jx], jy);
-
-    xy_pos_t ppos;
-    LOOP_L_N(ix, GRID_MAX_POINTS_X) {
-      ppos.x = mesh_index_to_xpos(ix);
-      LOOP_L_N(iy, GRID_MAX_POINTS_Y) {
-        ppos.y = mesh_index_to_ypos(iy);
-        if (isnan(z_values[ix][iy])) {
-          // undefined mesh point at (ppos.x,ppos.y), compute weighted LSF from original valid mesh points.
-          incremental_LSF_reset(&lsf_results);
-          xy_pos_t rpos;
-          LOOP_L_N(jx, GRID_MAX_POINTS_X) {
-            rpos.x = mesh_index_to_xpos(jx);
-            LOOP_L_N(jy, GRID_MAX_POINTS_Y) {
-              if (TEST(bitmap[jx], jy)) {
-                rpos.y = mesh_index_to_ypos(jy);
-                const float rz = z_values[jx][jy],
-                             w = 1.0f + weight_scaled / (rpos - ppos).magnitude();
-                incremental_WLSF(&lsf_results, rpos, rz, w);
-              }
-            }
-          }
-          if (finish_incremental_LSF(&lsf_results)) {
-            SERIAL_ECHOLNPGM("Insufficient data");
-            return;
-          }
-          const float ez = -lsf_results.D - lsf_results.A * ppos.x - lsf_results.B * ppos.y;
-          z_values[ix][iy] = ez;
-          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ix, iy, z_values[ix][iy]));
-          idle(); // housekeeping
-        }
-      }
+    #if ENABLED(EXTENSIBLE_UI)
+      GRID_LOOP(jx, jy) if (TEST(bitmap[jx], jy) && !isnan(z_values[jx][jy])) ExtUI::onMeshUpdate(jx, jy, z_values[jx][jy]);
+    #endif
+
+    if (!done) {
+      SERIAL_ECHOLNPGM("Insufficient data");
+      return;
     }
 
     SERIAL_ECHOLNPGM("done");
@@ -1840,10 +1802,10 @@ void unified_bed_leveling::smart_fill_mesh() {
 
     SERIAL_ECHOLNPGM("Subtracting mesh in slot ", param.KLS_storage_slot, " from current mesh.");
 
-    GRID_LOOP(x, y) {
-      z_values[x][y] -= tmp_z_values[x][y];
-      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
-    }
+    mesh_subtract(z_values, tmp_z_values);
+    #if ENABLED(EXTENSIBLE_UI)
+      GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, z_values[x][y]);
+    #endif
   }
 
 #endif // UBL_DEVEL_DEBUGGING
@@ -360,6 +360,11 @@
     #endif
 
     NOLESS(segments, 1U);                                                            // Must have at least one segment
+
+    #ifdef KINEMATIC_SEGMENT_TOLERANCE
+      segments = kinematic_segments(current_position, total, segments, seconds);     // Only as many as the kinematics need
+    #endif
+
     const float inv_segments = 1.0f / segments,                                      // Reciprocal to save calculation
                 segment_xyz_mm = SQRT(cart_xy_mm_2 + sq(total.z)) * inv_segments;    // Length of each segment
 
@@ -374,6 +379,9 @@
 
     xyze_pos_t raw = current_position;
 
+    // Every segment but the last steps the tower heights along the line
+    TERN_(DELTA_INCREMENTAL_IK, delta_line_ik.start(raw, diff, segments - 1));
+
     // Just do plain segmentation if UBL is inactive or the target is above the fade height
     if (!planner.leveling_active || !planner.leveling_active_at_z(destination.z)) {
       while (--segments) {
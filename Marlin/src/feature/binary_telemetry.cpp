@@ -0,0 +1,150 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BINARY_TELEMETRY)
+
+#include "binary_telemetry.h"
+#include "../MarlinCore.h"
+#include "../libs/crc16.h"
+#include "../gcode/queue.h"
+#include "../module/planner.h"
+#include "../module/stepper.h"
+#include "../module/temperature.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../sd/cardreader.h"
+#endif
+
+BinaryTelemetry telemetry;
+
+uint16_t BinaryTelemetry::interval_ms; // = 0
+millis_t BinaryTelemetry::next_ms; // = 0
+uint8_t BinaryTelemetry::seq; // = 0
+#if HAS_MULTI_SERIAL
+  SerialMask BinaryTelemetry::port_mask = SerialMask::All;
+#endif
+
+#define TELEMETRY_HEATERS (HOTENDS + ENABLED(HAS_HEATED_BED) + ENABLED(HAS_HEATED_CHAMBER))
+
+static constexpr uint8_t telemetry_payload_max = 6                 // type, seq, ms
+                                               + 1 + 5 * (TELEMETRY_HEATERS)
+                                               + 1 + FAN_COUNT
+                                               + 3                 // planned, queued, state
+                                               + 8                 // sdpos, sdsize
+                                               + 1 + 4 * (LOGICAL_AXES)
+                                               + 2;                // CRC16
+
+// A single COBS block covers up to 254 bytes, so frames never need a split code
+static_assert(telemetry_payload_max <= 254, "Binary telemetry frame is too large.");
+
+namespace {
+
+  struct FrameWriter {
+    uint8_t buf[telemetry_payload_max], len = 0;
+    void u8(const uint8_t v) { buf[len++] = v; }
+    void u16(const uint16_t v) { u8(v & 0xFF); u8(v >> 8); }
+    void u32(const uint32_t v) { u16(v & 0xFFFF); u16(v >> 16); }
+    void heater(const celsius_float_t temp, const celsius_t target, const int16_t power) {
+      u16(int16_t(temp * 10.0f)); u16(int16_t(target * 10)); u8(uint8_t(_MIN(power, 255)));
+    }
+  };
+
+  /**
+   * COBS-encode the frame straight to the serial port, bracketed by zero
+   * delimiters. Each code byte is the distance to the next zero in the source.
+   */
+  void send_cobs(const uint8_t * const src, const uint8_t len) {
+    SERIAL_CHAR('\0');
+    uint8_t start = 0;
+    for (uint8_t i = 0; i <= len; ++i) {
+      if (i == len || src[i] == 0) {
+        SERIAL_CHAR(char(i - start + 1));
+        for (uint8_t j = start; j < i; ++j) SERIAL_CHAR(char(src[j]));
+        start = i + 1;
+      }
+    }
+    SERIAL_CHAR('\0');
+  }
+
+}
+
+void BinaryTelemetry::set_interval(const uint16_t ms) {
+  interval_ms = ms ? _MAX(ms, uint16_t(BINARY_TELEMETRY_MIN_INTERVAL)) : 0;
+  next_ms = millis() + interval_ms;
+}
+
+void BinaryTelemetry::report() {
+  FrameWriter f;
+
+  f.u8(TELEMETRY_FRAME_STATUS);
+  f.u8(seq++);
+  f.u32(millis());
+
+  f.u8(TELEMETRY_HEATERS);
+  #if HAS_HOTEND
+    HOTEND_LOOP() f.heater(thermalManager.degHotend(e), thermalManager.degTargetHotend(e), thermalManager.getHeaterPower((heater_id_t)e));
+  #endif
+  #if HAS_HEATED_BED
+    f.heater(thermalManager.degBed(), thermalManager.degTargetBed(), thermalManager.getHeaterPower(H_BED));
+  #endif
+  #if HAS_HEATED_CHAMBER
+    f.heater(thermalManager.degChamber(), thermalManager.degTargetChamber(), thermalManager.getHeaterPower(H_CHAMBER));
+  #endif
+
+  f.u8(FAN_COUNT);
+  #if HAS_FAN
+    FANS_LOOP(i) f.u8(thermalManager.fan_speed[i]);
+  #endif
+
+  f.u8(planner.movesplanned());
+  f.u8(queue.ring_buffer.length);
+
+  uint8_t state = 0;
+  if (printingIsActive()) state |= TELEMETRY_PRINTING;
+  if (printingIsPaused()) state |= TELEMETRY_PAUSED;
+  if (TERN0(SDSUPPORT, IS_SD_PRINTING())) state |= TELEMETRY_SD_PRINT;
+  if (planner.has_blocks_queued()) state |= TELEMETRY_MOVING;
+  if (IsStopped()) state |= TELEMETRY_STOPPED;
+  f.u8(state);
+
+  #if ENABLED(SDSUPPORT)
+    const bool open = card.isFileOpen();
+    f.u32(open ? card.getIndex() : 0);
+    f.u32(open ? card.getFileSize() : 0);
+  #else
+    f.u32(0); f.u32(0);
+  #endif
+
+  f.u8(LOGICAL_AXES);
+  LOOP_LOGICAL_AXES(i) f.u32(uint32_t(stepper.position((AxisEnum)i)));
+
+  uint16_t crc = 0;
+  crc16(&crc, f.buf, f.len);
+  f.u16(crc);
+
+  PORT_REDIRECT(port_mask);
+  send_cobs(f.buf, f.len);
+}
+
+#endif // BINARY_TELEMETRY
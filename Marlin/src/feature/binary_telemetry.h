@@ -0,0 +1,89 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Binary telemetry frames
+ *
+ * A compact alternative to the M155 / M154 text reports. Every frame is
+ * sent as  0x00 <COBS(payload + CRC16)> 0x00  so a host can split frames
+ * from ordinary text replies, which never contain a zero byte.
+ *
+ * Payload (little-endian, packed):
+ *   uint8   type          TELEMETRY_FRAME_STATUS
+ *   uint8   seq           Incremented per frame, to detect drops
+ *   uint32  ms            millis() at sample time
+ *   uint8   heaters       Number of heater records that follow
+ *   { int16 temp, int16 target, uint8 power }[heaters]
+ *                         Temperatures in 0.1°C. Hotends, then bed, then chamber.
+ *   uint8   fans          Number of fan speeds that follow
+ *   uint8   fan[fans]     0-255
+ *   uint8   planned       Blocks in the planner buffer
+ *   uint8   queued        Commands in the command queue
+ *   uint8   state         TelemetryState flags
+ *   uint32  sdpos         Current SD file position (0 without SD)
+ *   uint32  sdsize        Open SD file size (0 without SD)
+ *   uint8   axes          Number of stepper counts that follow
+ *   int32   steps[axes]   Stepper positions in steps, logical axis order
+ *
+ * The CRC16 (CCITT, initial value 0) covers the payload and is appended
+ * low byte first.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define TELEMETRY_FRAME_STATUS 0x01
+
+enum TelemetryState : uint8_t {
+  TELEMETRY_PRINTING   = _BV(0),  // printingIsActive()
+  TELEMETRY_PAUSED     = _BV(1),  // printingIsPaused()
+  TELEMETRY_SD_PRINT   = _BV(2),  // Printing from SD
+  TELEMETRY_MOVING     = _BV(3),  // Planner has blocks queued
+  TELEMETRY_STOPPED    = _BV(7)   // Kill / Stop state
+};
+
+class BinaryTelemetry {
+public:
+  static uint16_t interval_ms;            // 0 = disabled
+  #if HAS_MULTI_SERIAL
+    static SerialMask port_mask;
+  #endif
+
+  static void set_interval(const uint16_t ms);
+
+  static void tick() {
+    if (!interval_ms) return;
+    const millis_t ms = millis();
+    if (ELAPSED(ms, next_ms)) {
+      next_ms = ms + interval_ms;
+      report();
+    }
+  }
+
+  static void report();
+
+private:
+  static millis_t next_ms;
+  static uint8_t seq;
+};
+
+extern BinaryTelemetry telemetry;
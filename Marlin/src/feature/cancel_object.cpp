@@ -27,6 +27,12 @@
 #include "cancel_object.h"
 #include "../gcode/gcode.h"
 #include "../lcd/marlinui.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+
+#if ENABLED(FWRETRACT)
+  #include "fwretract.h"
+#endif
 
 CancelObject cancelable;
 
@@ -35,14 +41,23 @@ int8_t CancelObject::object_count, // = 0
 uint32_t CancelObject::canceled; // = 0x0000
 bool CancelObject::skipping; // = false
 
+xyze_pos_t CancelObject::skip_start;
+#if HAS_EXTRUDERS
+  float CancelObject::retracted_e, // = 0
+        CancelObject::skip_retracted_e;
+#endif
+#if ENABLED(FWRETRACT)
+  bool CancelObject::skip_fwretracted;
+#endif
+
 void CancelObject::set_active_object(const int8_t obj) {
   active_object = obj;
   if (WITHIN(obj, 0, 31)) {
     if (obj >= object_count) object_count = obj + 1;
-    skipping = TEST(canceled, obj);
+    set_skipping(TEST(canceled, obj));
   }
   else
-    skipping = false;
+    set_skipping(false);
 
   #if BOTH(HAS_STATUS_MESSAGE, CANCEL_OBJECTS_REPORTING)
     if (active_object >= 0)
@@ -55,15 +70,115 @@ void CancelObject::set_active_object(const int8_t obj) {
 void CancelObject::cancel_object(const int8_t obj) {
   if (WITHIN(obj, 0, 31)) {
     SBI(canceled, obj);
-    if (obj == active_object) skipping = true;
+    if (obj == active_object) set_skipping(true);
   }
 }
 
 void CancelObject::uncancel_object(const int8_t obj) {
   if (WITHIN(obj, 0, 31)) {
     CBI(canceled, obj);
-    if (obj == active_object) skipping = false;
+    if (obj == active_object) set_skipping(false);
+  }
+}
+
+void CancelObject::reset() {
+  // A job is starting, so drop an unfinished skip without moving.
+  // The nozzle is still where skipping began, so start from there.
+  if (skipping) {
+    skipping = false;
+    const float e = current_position.e;
+    current_position = skip_start;
+    current_position.e = e;
+    sync_plan_position();
+  }
+  canceled = 0x0000;
+  object_count = 0;
+  clear_active_object();
+}
+
+bool CancelObject::skip_move() {
+  #if HAS_EXTRUDERS
+    // Follow the slicer's retract / recover moves so they can be balanced after a skip
+    const float de = destination.e - current_position.e;
+    if (de < 0)
+      retracted_e -= de;
+    else if (de > 0)
+      retracted_e = _MAX(retracted_e - de, 0.0f);
+  #endif
+
+  if (!skipping) return false;
+
+  current_position = destination;                   // Keep track of the position the G-code expects
+  return true;
+}
+
+void CancelObject::set_skipping(const bool skip) {
+  if (skip == skipping) return;
+  skipping = skip;
+  if (skip) {
+    skip_start = current_position;
+    TERN_(HAS_EXTRUDERS, skip_retracted_e = retracted_e);
+    TERN_(FWRETRACT, skip_fwretracted = fwretract.retracted[active_extruder]);
   }
+  else
+    end_skip();
+}
+
+/**
+ * Catch up with the G-code after the moves of a canceled object. The nozzle
+ * is still where skipping began, so make a single travel to where the G-code
+ * left it, and leave the filament retracted (or not) as the G-code expects.
+ * Travel at the probing / homing feedrates, not the last G-code feedrate.
+ */
+void CancelObject::end_skip() {
+  const xyze_pos_t exit_pos = current_position;
+
+  current_position = skip_start;
+  current_position.e = exit_pos.e;
+  sync_plan_position_e();                           // Skipped extrusion was never made
+
+  #if HAS_EXTRUDERS
+    const float retract_e = retracted_e - skip_retracted_e;
+    const feedRate_t fr_e = planner.settings.max_feedrate_mm_s[E_AXIS_N(active_extruder)];
+    destination = current_position;
+    if (retract_e > 0) {                            // Retract before the travel
+      destination.e -= retract_e;
+      prepare_internal_move_to_destination(fr_e);
+    }
+  #endif
+  #if ENABLED(FWRETRACT)
+    const bool fwretracted = fwretract.retracted[active_extruder];
+    fwretract.retracted[active_extruder] = skip_fwretracted;
+    if (fwretracted) fwretract.retract(true);
+  #endif
+
+  // Raise first, lower last
+  const feedRate_t fr_xy = XY_PROBE_FEEDRATE_MM_S, fr_z = homing_feedrate(Z_AXIS);
+  destination = current_position;
+  if (exit_pos.z > destination.z) {
+    destination.z = exit_pos.z;
+    prepare_internal_move_to_destination(fr_z);
+  }
+  LOOP_LINEAR_AXES(i) if (i != Z_AXIS) destination[i] = exit_pos[i];
+  if (destination != current_position) prepare_internal_move_to_destination(fr_xy);
+  if (exit_pos.z != destination.z) {
+    destination.z = exit_pos.z;
+    prepare_internal_move_to_destination(fr_z);
+  }
+
+  #if ENABLED(FWRETRACT)
+    if (!fwretracted) fwretract.retract(false);
+  #endif
+  #if HAS_EXTRUDERS
+    if (retract_e < 0) {                            // Recover after the travel
+      destination = current_position;
+      destination.e -= retract_e;
+      prepare_internal_move_to_destination(fr_e);
+    }
+  #endif
+
+  current_position.e = exit_pos.e;
+  sync_plan_position_e();
 }
 
 void CancelObject::report() {
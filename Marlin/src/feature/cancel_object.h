@@ -21,6 +21,8 @@
  */
 #pragma once
 
+#include "../inc/MarlinConfigPre.h"
+
 #include <stdint.h>
 
 class CancelObject {
@@ -35,7 +37,25 @@ public:
   static inline bool is_canceled(const int8_t obj) { return TEST(canceled, obj); }
   static inline void clear_active_object() { set_active_object(-1); }
   static inline void cancel_active_object() { cancel_object(active_object); }
-  static inline void reset() { canceled = 0x0000; object_count = 0; clear_active_object(); }
+  static void reset();
+
+  /**
+   * Account for the G-code move to 'destination'. A move belonging to a
+   * canceled object is only tracked. Return 'true' if the caller should skip it.
+   */
+  static bool skip_move();
+
+private:
+  static xyze_pos_t skip_start;       // Where the nozzle actually stopped when skipping began
+  #if HAS_EXTRUDERS
+    static float retracted_e,         // Filament retracted by G-code E moves
+                 skip_retracted_e;    // ...when skipping began
+  #endif
+  #if ENABLED(FWRETRACT)
+    static bool skip_fwretracted;     // Firmware retract state when skipping began
+  #endif
+  static void set_skipping(const bool skip);
+  static void end_skip();
 };
 
 extern CancelObject cancelable;
@@ -0,0 +1,155 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(CRITICAL_SECTION_TRACE)
+
+#include "critical_trace.h"
+#include "trace_clock.h"
+
+#ifdef __PLAT_LINUX__
+  #include <stdio.h>
+#endif
+
+CriticalTrace critical_trace;
+
+CriticalTrace::site_t CriticalTrace::sites[CRITICAL_TRACE_SITES];
+uint8_t CriticalTrace::site_count; // = 0
+uint32_t CriticalTrace::lost; // = 0
+CriticalTrace::open_t CriticalTrace::open[TRACE_KINDS];
+
+static constexpr float ticks_per_us = trace_ticks_per_us;
+
+// The LINUX "ISRs" are threads and its critical section macros are empty, so guard the table with a spin lock
+#ifdef __PLAT_LINUX__
+  static bool table_lock; // = false
+  #define TRACE_LOCK()   while (__atomic_test_and_set(&table_lock, __ATOMIC_ACQUIRE)) { /* spin */ }
+  #define TRACE_UNLOCK() __atomic_clear(&table_lock, __ATOMIC_RELEASE)
+#else
+  #define TRACE_LOCK()   CRITICAL_SECTION_START()
+  #define TRACE_UNLOCK() CRITICAL_SECTION_END()
+#endif
+
+void CriticalTrace::init() { trace_clock_init(); }
+
+void CriticalTrace::reset() {
+  TRACE_LOCK();
+  site_count = 0;
+  lost = 0;
+  TRACE_UNLOCK();
+}
+
+void CriticalTrace::enter(const CriticalKind kind, const char * const file, const uint16_t line) {
+  TRACE_LOCK();
+  open_t &o = open[kind];
+  if (!o.file) {
+    o.file = file;
+    o.line = line;
+    o.start = trace_ticks();
+  }
+  TRACE_UNLOCK();
+}
+
+void CriticalTrace::leave(const CriticalKind kind) {
+  const uint32_t now = trace_ticks();
+  TRACE_LOCK();
+  open_t &o = open[kind];
+  if (o.file) {
+    const uint32_t ticks = now - o.start;
+
+    // Find the site, or add it while there's room
+    uint8_t i = 0;
+    while (i < site_count && !(sites[i].line == o.line && sites[i].kind == kind && sites[i].file == o.file)) i++;
+    if (i == site_count && site_count < CRITICAL_TRACE_SITES)
+      sites[site_count++] = { o.file, o.line, kind, 0, 0, 0 };
+
+    if (i < site_count) {
+      site_t &s = sites[i];
+      s.count++;
+      s.total_ticks += ticks;
+      NOLESS(s.max_ticks, ticks);
+    }
+    else
+      lost++;
+
+    o.file = nullptr;
+  }
+  TRACE_UNLOCK();
+}
+
+// Copy the table and sort it by worst time, longest first
+static uint8_t snapshot(CriticalTrace::site_t (&list)[CRITICAL_TRACE_SITES], const CriticalTrace::site_t * const sites, const uint8_t &site_count) {
+  TRACE_LOCK();
+  const uint8_t n = site_count;
+  LOOP_L_N(i, n) list[i] = sites[i];
+  TRACE_UNLOCK();
+
+  for (uint8_t i = 1; i < n; i++)
+    for (uint8_t j = i; j && list[j - 1].max_ticks < list[j].max_ticks; j--) {
+      const CriticalTrace::site_t t = list[j]; list[j] = list[j - 1]; list[j - 1] = t;
+    }
+  return n;
+}
+
+static const char* base_name(const char * const path) {
+  const char *name = path;
+  for (const char *p = path; *p; p++) if (*p == '/' || *p == '\\') name = p + 1;
+  return name;
+}
+
+void CriticalTrace::report() {
+  site_t list[CRITICAL_TRACE_SITES];
+  const uint8_t n = snapshot(list, sites, site_count);
+
+  SERIAL_ECHOLNPGM("Critical sections, worst first (us):");
+  LOOP_L_N(i, n) {
+    const site_t &s = list[i];
+    SERIAL_ECHO(base_name(s.file));
+    SERIAL_ECHOPGM(":", s.line);
+    if (s.kind == TRACE_STEPPER) SERIAL_ECHOPGM(" STEPPER"); else SERIAL_ECHOPGM(" ISRS");
+    SERIAL_ECHOPGM(" max:"); SERIAL_ECHO_F(s.max_ticks / ticks_per_us);
+    SERIAL_ECHOPGM(" avg:"); SERIAL_ECHO_F(float(s.total_ticks) / s.count / ticks_per_us);
+    SERIAL_ECHOLNPGM(" count:", s.count);
+  }
+  if (lost) SERIAL_ECHOLNPGM("Untracked sections: ", lost);
+}
+
+#ifdef __PLAT_LINUX__
+
+  void CriticalTrace::write_csv(const char * const path) {
+    FILE * const f = fopen(path, "w");
+    if (!f) return;
+    site_t list[CRITICAL_TRACE_SITES];
+    const uint8_t n = snapshot(list, sites, site_count);
+    fputs("file,line,kind,count,max_us,avg_us\n", f);
+    LOOP_L_N(i, n) {
+      const site_t &s = list[i];
+      fprintf(f, "%s,%u,%s,%u,%.3f,%.3f\n", base_name(s.file), s.line, s.kind == TRACE_STEPPER ? "STEPPER" : "ISRS",
+        unsigned(s.count), s.max_ticks / ticks_per_us, double(s.total_ticks) / s.count / ticks_per_us);
+    }
+    fclose(f);
+  }
+
+#endif
+
+#endif // CRITICAL_SECTION_TRACE
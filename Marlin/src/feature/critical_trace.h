@@ -0,0 +1,72 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Critical section tracer
+ *
+ * Each stretch with interrupts disabled or with the Stepper ISR held off is
+ * timed from enter() to leave() and charged to the call site that started it.
+ * Stepper::suspend() passes its caller's location, so every suspend() /
+ * wake_up() pair is covered. DISABLE_ISRS() / ENABLE_ISRS() pairs in the core
+ * are marked with TRACE_ISRS_OFF() / TRACE_ISRS_ON().
+ *
+ * Only the outermost section of each kind is timed. A leave() with no open
+ * section (e.g., wake_up() to start a new move) is ignored.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+enum CriticalKind : uint8_t { TRACE_ISRS, TRACE_STEPPER, TRACE_KINDS };
+
+class CriticalTrace {
+public:
+  typedef struct {
+    const char *file;
+    uint16_t line;
+    CriticalKind kind;
+    uint32_t count, max_ticks;
+    uint64_t total_ticks;
+  } site_t;
+
+  static void init();
+  static void reset();
+  static void enter(const CriticalKind kind, const char * const file, const uint16_t line);
+  static void leave(const CriticalKind kind);
+
+  // List the sites, worst first
+  static void report();
+  #ifdef __PLAT_LINUX__
+    static void write_csv(const char * const path);
+  #endif
+
+private:
+  static site_t sites[CRITICAL_TRACE_SITES];
+  static uint8_t site_count;
+  static uint32_t lost;                   // Sections not counted because the table was full
+  static struct open_t { const char *file; uint16_t line; uint32_t start; } open[TRACE_KINDS];
+};
+
+extern CriticalTrace critical_trace;
+
+#define TRACE_ISRS_OFF() critical_trace.enter(TRACE_ISRS, __FILE__, __LINE__)
+#define TRACE_ISRS_ON()  critical_trace.leave(TRACE_ISRS)
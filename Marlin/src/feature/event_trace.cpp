@@ -0,0 +1,82 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(EVENT_TRACE)
+
+#include "event_trace.h"
+#include "trace_clock.h"
+#include "../libs/hex_print.h"
+
+EventTrace event_trace;
+
+EventTrace::event_t EventTrace::ring[EVENT_TRACE_SIZE];
+uint16_t EventTrace::head; // = 0
+uint32_t EventTrace::written; // = 0
+bool EventTrace::paused; // = false
+
+void EventTrace::init() { trace_clock_init(); }
+
+void EventTrace::record(const EventId id, const uint8_t arg8/*=0*/, const uint16_t arg/*=0*/) {
+  if (paused) return;
+  CRITICAL_SECTION_START();
+  ring[head] = { trace_ticks(), id, arg8, arg };
+  head = (head + 1) & (EVENT_TRACE_SIZE - 1);
+  written++;
+  CRITICAL_SECTION_END();
+}
+
+void EventTrace::clear() {
+  CRITICAL_SECTION_START();
+  head = 0;
+  written = 0;
+  CRITICAL_SECTION_END();
+}
+
+/**
+ * ET:BEGIN us:<ticks per us> n:<records> lost:<overwritten>
+ * ET:<ticks><id><arg8><arg>    All hex, 8+2+2+4 digits
+ * ET:END
+ */
+void EventTrace::dump() {
+  const bool was_paused = paused;
+  paused = true;
+
+  const uint16_t n = _MIN(written, uint32_t(EVENT_TRACE_SIZE));
+  SERIAL_ECHOLNPGM("ET:BEGIN us:", trace_ticks_per_us, " n:", n, " lost:", written - n);
+  for (uint16_t i = 0, r = (head - n) & (EVENT_TRACE_SIZE - 1); i < n; i++, r = (r + 1) & (EVENT_TRACE_SIZE - 1)) {
+    const event_t &e = ring[r];
+    SERIAL_ECHOPGM("ET:");
+    print_hex_word(e.ticks >> 16); print_hex_word(e.ticks);
+    print_hex_byte(e.id); print_hex_byte(e.arg8);
+    print_hex_word(e.arg);
+    SERIAL_EOL();
+    if (!(i & 0x3F)) watchdog_refresh();
+  }
+  SERIAL_ECHOLNPGM("ET:END");
+
+  clear();
+  paused = was_paused;
+}
+
+#endif // EVENT_TRACE
@@ -0,0 +1,78 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Event trace
+ *
+ * A ring of small timestamped records in RAM, cheap enough to leave on while
+ * printing. When the ring is full the oldest records are overwritten, so it
+ * always holds the moments leading up to a stall. M132 sends the ring to the
+ * host, and buildroot/share/scripts/event_trace.py turns the capture into
+ * Chrome trace JSON for chrome://tracing or ui.perfetto.dev.
+ *
+ * Records may be added from the main loop and from ISRs.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+// Keep in sync with event_trace.py
+enum EventId : uint8_t {
+  EV_NONE,
+  EV_BLOCK_QUEUED,    // arg8: block index   arg: blocks in the planner
+  EV_BLOCK_START,     // arg8: block index   arg: blocks in the planner
+  EV_BLOCK_DONE,      // arg8: block index   arg: blocks in the planner
+  EV_CMD_BEGIN,       //                     arg: commands in the queue
+  EV_CMD_END,         // arg8: G/M/T letter  arg: code number
+  EV_SD_READ_BEGIN,   // arg8: block count   arg: low 16 bits of the first block
+  EV_SD_READ_END,     // arg8: 1 if failed
+  EV_HEATER_PWM,      // arg8: heater_id_t   arg: soft PWM (0-127)
+  EV_UI_BEGIN,        // Screen redraw starting
+  EV_UI_END,          // arg8: 1 if more pages remain
+  EV_COUNT
+};
+
+class EventTrace {
+public:
+  typedef struct {
+    uint32_t ticks;   // Timestamp, trace_ticks_per_us per microsecond
+    EventId id;
+    uint8_t arg8;
+    uint16_t arg;
+  } event_t;
+
+  static bool paused;
+
+  static void init();
+  static void record(const EventId id, const uint8_t arg8=0, const uint16_t arg=0);
+  static void clear();
+
+  // Send the ring, oldest first, then clear it
+  static void dump();
+
+private:
+  static event_t ring[EVENT_TRACE_SIZE];
+  static uint16_t head;     // Next slot to write
+  static uint32_t written;  // Records since the last clear
+};
+
+extern EventTrace event_trace;
@@ -42,6 +42,10 @@ FWRetract fwretract; // Single instance - this calls the constructor
   #include "mixing.h"
 #endif
 
+#if ENABLED(CANCEL_OBJECTS)
+  #include "cancel_object.h"
+#endif
+
 // private:
 
 #if HAS_MULTI_EXTRUDER
@@ -105,6 +109,15 @@ void FWRetract::retract(const bool retracting E_OPTARG(bool swapping/*=false*/))
     constexpr bool swapping = false;
   #endif
 
+  #if ENABLED(CANCEL_OBJECTS)
+    // A canceled object is not printed. Only note the state for when skipping ends.
+    if (cancelable.skipping) {
+      retracted[active_extruder] = retracting;
+      TERN_(HAS_MULTI_EXTRUDER, if (swapping) retracted_swap[active_extruder] = retracting);
+      return;
+    }
+  #endif
+
   /* // debugging
     SERIAL_ECHOLNPGM(
       "retracting ", AS_DIGIT(retracting),
@@ -0,0 +1,145 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PLANNER_STARVATION_MONITOR)
+
+#include "planner_monitor.h"
+#include "../module/planner.h"
+#include "../MarlinCore.h"
+
+PlannerMonitor planner_monitor;
+
+static constexpr PlannerMonitor::stats_t no_stats = { 0, 0, 0xFF };
+
+PlannerMonitor::stats_t PlannerMonitor::total = no_stats, PlannerMonitor::current = no_stats,
+                        PlannerMonitor::last_layer = no_stats, PlannerMonitor::worst_layer = no_stats;
+uint16_t PlannerMonitor::layer, PlannerMonitor::worst_layer_num;
+bool PlannerMonitor::layer_reports, PlannerMonitor::printing, PlannerMonitor::layer_done;
+uint8_t PlannerMonitor::waits; // = 0
+volatile bool PlannerMonitor::active; // = false
+volatile uint8_t PlannerMonitor::isr_min_depth = 0xFF;
+volatile uint16_t PlannerMonitor::isr_underruns; // = 0
+float PlannerMonitor::layer_z = -999, PlannerMonitor::last_e; // = 0
+millis_t PlannerMonitor::last_ms;
+AutoReporter<PlannerMonitor::AutoReport> PlannerMonitor::auto_reporter;
+
+void PlannerMonitor::reset() {
+  CRITICAL_SECTION_START();
+  isr_min_depth = 0xFF;
+  isr_underruns = 0;
+  CRITICAL_SECTION_END();
+  total = current = last_layer = worst_layer = no_stats;
+  layer = worst_layer_num = 0;
+  layer_z = -999;
+  last_e = 0;
+}
+
+// Move the counts from the Stepper ISR into the current layer
+void PlannerMonitor::take_isr_counts() {
+  CRITICAL_SECTION_START();
+  const uint8_t d = isr_min_depth;
+  const uint16_t u = isr_underruns;
+  isr_min_depth = 0xFF;
+  isr_underruns = 0;
+  CRITICAL_SECTION_END();
+  NOMORE(current.min_depth, d);
+  current.underruns += u;
+  total.underruns += u;
+  NOMORE(total.min_depth, d);
+}
+
+void PlannerMonitor::next_layer(const_float_t z) {
+  layer_z = z;
+  if (!printing) return;
+  take_isr_counts();
+  if (layer) {
+    last_layer = current;
+    // Most underruns, then fewest blocks, is the worst
+    if (!worst_layer_num || current.underruns > worst_layer.underruns
+      || (current.underruns == worst_layer.underruns && current.min_depth < worst_layer.min_depth)
+    ) { worst_layer = current; worst_layer_num = layer; }
+    layer_done = true;
+  }
+  current = no_stats;
+  layer++;
+}
+
+void PlannerMonitor::update() {
+  const millis_t ms = millis();
+
+  // Start counting afresh with each print
+  const bool was_printing = printing;
+  printing = printJobOngoing() || printingIsPaused();
+  if (printing && !was_printing) reset();
+
+  active = printingIsActive() && !waits && !TERN0(HAS_RESUME_CONTINUE, wait_for_user);
+
+  if (active && !planner.has_blocks_queued()) {
+    const millis_t empty = ms - last_ms;
+    current.empty_ms += empty;
+    total.empty_ms += empty;
+  }
+  last_ms = ms;
+
+  if (layer_done) {
+    layer_done = false;
+    if (layer_reports) {
+      SERIAL_ECHOPGM("Layer ", layer - 1);
+      report_stats(last_layer);
+      SERIAL_EOL();
+    }
+  }
+}
+
+void PlannerMonitor::report_stats(const stats_t &s) {
+  SERIAL_ECHOPGM(" underruns:", s.underruns, " empty:", s.empty_ms, "ms min blocks:");
+  if (s.min_depth == 0xFF) SERIAL_CHAR('-'); else SERIAL_ECHO(s.min_depth);
+}
+
+/**
+ * Planner underruns:3 empty:120ms min blocks:1 buffered:80ms
+ * Layer 12 underruns:0 empty:0ms min blocks:9
+ * Worst layer 3 underruns:3 empty:120ms min blocks:1
+ */
+void PlannerMonitor::report() {
+  take_isr_counts();
+  SERIAL_ECHOPGM("Planner");
+  report_stats(total);
+  #if HAS_BLOCK_BUFFER_RUNTIME
+    SERIAL_ECHOPGM(" buffered:", planner.block_buffer_runtime(), "ms");
+  #endif
+  SERIAL_EOL();
+  if (layer) {
+    SERIAL_ECHOPGM("Layer ", layer);
+    report_stats(current);
+    SERIAL_EOL();
+  }
+  if (worst_layer_num) {
+    SERIAL_ECHOPGM("Worst layer ", worst_layer_num);
+    report_stats(worst_layer);
+    SERIAL_EOL();
+  }
+}
+
+#endif // PLANNER_STARVATION_MONITOR
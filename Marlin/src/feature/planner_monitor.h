@@ -0,0 +1,92 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Planner starvation monitor
+ *
+ * A block that starts with nothing queued behind it has to end at a stop, so
+ * a host or SD card that can't keep up shows as a stutter. While a print is
+ * running this counts those "underruns", adds up the time the planner sits
+ * empty, and keeps the fewest blocks queued at any block start, per layer.
+ *
+ * A new layer begins with the first extruding move above the last layer,
+ * as it is queued, so Z-hops don't count.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../libs/autoreport.h"
+
+class PlannerMonitor {
+public:
+  typedef struct {
+    uint16_t underruns;   // Blocks started with nothing queued behind them
+    uint32_t empty_ms;    // Time with no blocks in the planner
+    uint8_t min_depth;    // Fewest blocks queued, including the one starting
+  } stats_t;
+
+  static stats_t total, last_layer, worst_layer;
+  static uint16_t layer, worst_layer_num;
+  static bool layer_reports;
+
+  static void reset();
+  static void update();     // From idle()
+  static void report();
+
+  // Stretches that let the planner run dry on purpose (M400, G4, M109, homing...) don't count
+  struct Wait {
+    Wait()  { waits++; active = false; }
+    ~Wait() { waits--; }
+  };
+
+  // Check for a layer change as a move is queued
+  static void line_queued(const_float_t z, const_float_t e) {
+    if (e > last_e && z > layer_z + 0.001f) next_layer(z);
+    last_e = e;
+  }
+
+  // From the Stepper ISR as a block starts. 'depth' includes the new block.
+  static void block_started(const uint8_t depth) {
+    if (!active) return;
+    NOMORE(isr_min_depth, depth);
+    if (depth < 2) isr_underruns++;
+  }
+
+  struct AutoReport { static void report() { PlannerMonitor::report(); } };
+  static AutoReporter<AutoReport> auto_reporter;
+
+private:
+  static volatile bool active;
+  static volatile uint8_t isr_min_depth;
+  static volatile uint16_t isr_underruns;
+  static uint8_t waits;
+  static bool printing, layer_done;
+  static stats_t current;
+  static float layer_z, last_e;
+  static millis_t last_ms;
+
+  static void next_layer(const_float_t z);
+  static void take_isr_counts();
+  static void report_stats(const stats_t &s);
+};
+
+extern PlannerMonitor planner_monitor;
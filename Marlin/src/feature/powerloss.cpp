@@ -291,6 +291,9 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
     // and a flag whether the raise was already done here.
     if (IS_SD_PRINTING()) save(true, zraise, ENABLED(BACKUP_POWER_SUPPLY));
 
+    // Close an upload in progress so the clusters allocated ahead of it are freed
+    TERN_(SD_STREAMING_UPLOAD, if (card.flag.saving) card.closefile());
+
     // Disable all heaters to reduce power loss
     thermalManager.disable_all_heaters();
 
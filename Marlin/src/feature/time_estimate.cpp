@@ -0,0 +1,105 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(REMAINING_TIME_ESTIMATE)
+
+#include "time_estimate.h"
+#include "../module/planner.h"
+#include "../MarlinCore.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../sd/cardreader.h"
+#endif
+
+TimeEstimate time_estimate;
+
+bool TimeEstimate::printing, TimeEstimate::known;
+millis_t TimeEstimate::last_ms, TimeEstimate::run_ms, TimeEstimate::anchor_run_ms, TimeEstimate::slicer_start_run_ms;
+uint32_t TimeEstimate::anchor_left_ms, TimeEstimate::slicer_start_s;
+float TimeEstimate::slicer_scale = 1;
+#if ENABLED(SDSUPPORT)
+  uint32_t TimeEstimate::start_pos;
+  millis_t TimeEstimate::next_ms;
+#endif
+
+// Slicer times only start to count once they span this much
+#define SLICER_SCALE_MIN_S 60
+
+// When the last queued move will have run, in time spent moving
+millis_t TimeEstimate::queue_end_run_ms() { return run_ms + millis_t(planner.queued_time() * 1000); }
+
+void TimeEstimate::update() {
+  const millis_t ms = millis();
+
+  // Start afresh with each print
+  const bool was_printing = printing;
+  printing = printJobOngoing() || printingIsPaused();
+  if (printing != was_printing) {
+    known = false;
+    run_ms = slicer_start_s = 0;
+    slicer_scale = 1;
+    TERN_(SDSUPPORT, start_pos = 0);
+  }
+
+  // The steppers are busy whenever blocks are queued
+  if (printing && planner.has_blocks_queued()) run_ms += ms - last_ms;
+  last_ms = ms;
+
+  #if ENABLED(SDSUPPORT)
+    // Without the slicer's times, go by the planned time per byte of the file
+    if (printing && !slicer_start_s && card.isFileOpen() && ELAPSED(ms, next_ms)) {
+      next_ms = ms + 1000;
+      const uint32_t pos = card.getIndex(), size = card.getFileSize();
+      if (!start_pos) {
+        if (planner.has_blocks_queued()) start_pos = pos;
+      }
+      else if (pos > start_pos && (pos - start_pos) * 100 >= size - start_pos) {   // At least 1% in
+        anchor_run_ms = queue_end_run_ms();
+        anchor_left_ms = float(anchor_run_ms) * (size - pos) / (pos - start_pos);
+        known = true;
+      }
+    }
+  #endif
+}
+
+void TimeEstimate::slicer_remaining(const uint32_t s) {
+  if (!printing) return;
+  anchor_run_ms = queue_end_run_ms();
+  if (!slicer_start_s) {
+    slicer_start_s = s;
+    slicer_start_run_ms = anchor_run_ms;
+  }
+  else if (slicer_start_s >= s + (SLICER_SCALE_MIN_S))
+    slicer_scale = constrain(0.001f * (anchor_run_ms - slicer_start_run_ms) / (slicer_start_s - s), 0.25f, 4.0f);
+  anchor_left_ms = s * slicer_scale * 1000;
+  known = true;
+}
+
+uint32_t TimeEstimate::remaining() {
+  if (!printing || !known) return 0;
+  const millis_t to_anchor = anchor_run_ms > run_ms ? anchor_run_ms - run_ms : 0;
+  return (to_anchor + anchor_left_ms + 999) / 1000;
+}
+
+#endif // REMAINING_TIME_ESTIMATE
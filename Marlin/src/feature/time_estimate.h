@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Remaining print time estimate
+ *
+ * The queued moves are timed through their acceleration profiles, so the
+ * time until the last parsed command has run is known. The rest of the file
+ * is estimated from the slicer's M73 R, scaled by how the slicer's times
+ * have compared with the planner's so far, or for SD prints without M73 R
+ * from the planned time per byte of the file so far.
+ *
+ * Only time spent moving counts, so heating, pauses and other waits don't
+ * skew the rate. The countdown holds still while they last.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class TimeEstimate {
+public:
+  static void update();                             // From idle()
+  static void slicer_remaining(const uint32_t s);   // M73 R, in seconds
+  static uint32_t remaining();                      // Seconds to go, 0 if not known yet
+
+private:
+  static bool printing, known;
+  static millis_t last_ms,
+                  run_ms,                 // Time spent moving since the print started
+                  anchor_run_ms;          // Time moving when the last estimated command will have run
+  static uint32_t anchor_left_ms;         // Estimated time for the rest of the file from there
+  static uint32_t slicer_start_s;         // The first M73 R of the print...
+  static millis_t slicer_start_run_ms;    // ...and the time moving when its command runs
+  static float slicer_scale;              // Planned over slicer time so far
+
+  #if ENABLED(SDSUPPORT)
+    static uint32_t start_pos;            // File position when the first move was queued
+    static millis_t next_ms;
+  #endif
+
+  static millis_t queue_end_run_ms();
+};
+
+extern TimeEstimate time_estimate;
@@ -0,0 +1,57 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Timestamps for the debug tracers
+ *
+ * The DWT cycle counter on Cortex-M3/M4, which costs one load and wraps
+ * every 2^32 cycles (about 60s at 72MHz). micros() elsewhere.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+
+  #define DWT_CTRL   (*(volatile uint32_t *)0xE0001000)
+  #define DWT_CYCCNT (*(volatile uint32_t *)0xE0001004)
+  #define DEMCR      (*(volatile uint32_t *)0xE000EDFC)
+
+  FORCE_INLINE static uint32_t trace_ticks() { return DWT_CYCCNT; }
+  static constexpr uint32_t trace_ticks_per_us = (F_CPU) / 1000000UL;
+
+  // Start the cycle counter. Safe to call more than once.
+  FORCE_INLINE static void trace_clock_init() {
+    if (!(DWT_CTRL & _BV32(0))) {
+      DEMCR |= _BV32(24);       // TRCENA
+      DWT_CYCCNT = 0;
+      DWT_CTRL |= _BV32(0);     // CYCCNTENA
+    }
+  }
+
+#else
+
+  FORCE_INLINE static uint32_t trace_ticks() { return micros(); }
+  static constexpr uint32_t trace_ticks_per_us = 1;
+  FORCE_INLINE static void trace_clock_init() {}
+
+#endif
@@ -75,6 +75,7 @@ void GcodeSuite::M420() {
         Z_VALUES(x, y) = 0.001 * random(-200, 200);
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, Z_VALUES(x, y)));
       }
+      TERN_(AUTO_BED_LEVELING_BILINEAR, refresh_bed_level());
       SERIAL_ECHOPGM("Simulated " STRINGIFY(GRID_MAX_POINTS_X) "x" STRINGIFY(GRID_MAX_POINTS_Y) " mesh ");
       SERIAL_ECHOPGM(" (", x_min);
       SERIAL_CHAR(','); SERIAL_ECHO(y_min);
@@ -149,35 +150,20 @@ void GcodeSuite::M420() {
 
         #else
 
-          #if ENABLED(M420_C_USE_MEAN)
+          mesh_stats_t st;
+          mesh_stats(st, Z_VALUES_ARR);
 
-            // Get the sum and average of all mesh values
-            float mesh_sum = 0;
-            GRID_LOOP(x, y) mesh_sum += Z_VALUES(x, y);
-            const float zmean = mesh_sum / float(GRID_MAX_POINTS);
-
-          #else // midrange
-
-            // Find the low and high mesh values.
-            float lo_val = 100, hi_val = -100;
-            GRID_LOOP(x, y) {
-              const float z = Z_VALUES(x, y);
-              NOMORE(lo_val, z);
-              NOLESS(hi_val, z);
-            }
-            // Get the midrange plus C value. (The median may be better.)
-            const float zmean = (lo_val + hi_val) / 2.0 + cval;
-
-          #endif
+          // Use the mean, or the midrange plus C value. (The median may be better.)
+          const float zmean = TERN(M420_C_USE_MEAN, st.mean, (st.lo + st.hi) / 2.0 + cval);
 
           // If not very close to 0, adjust the mesh
           if (!NEAR_ZERO(zmean)) {
             set_bed_leveling_enabled(false);
             // Subtract the mean from all values
-            GRID_LOOP(x, y) {
-              Z_VALUES(x, y) -= zmean;
-              TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, Z_VALUES(x, y)));
-            }
+            mesh_offset(Z_VALUES_ARR, -zmean);
+            #if ENABLED(EXTENSIBLE_UI)
+              GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, Z_VALUES(x, y));
+            #endif
             TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
           }
 
@@ -207,6 +193,12 @@ void GcodeSuite::M420() {
         #endif
       }
     #endif
+    #if HAS_LEVELED_SEGMENTS
+      SERIAL_ECHO_START();
+      SERIAL_ECHOPGM("Leveled segments:", leveled_segment_count, " over ");
+      SERIAL_ECHO(leveled_segment_mm);
+      SERIAL_ECHOLNPAIR_F("mm, per mm: ", leveled_segment_mm ? leveled_segment_count / leveled_segment_mm : 0, 3);
+    #endif
   }
 
   #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
@@ -44,10 +44,23 @@
    *    A = Alpha (Tower 1) diagonal rod trim
    *    B = Beta  (Tower 2) diagonal rod trim
    *    C = Gamma (Tower 3) diagonal rod trim
+   *
+   * With DELTA_INCREMENTAL_IK or KINEMATIC_SEGMENT_TOLERANCE:
+   *    V = Report segmentation statistics
    */
   void GcodeSuite::M665() {
     if (!parser.seen_any()) return M665_report();
 
+    #if ENABLED(DELTA_INCREMENTAL_IK) || defined(KINEMATIC_SEGMENT_TOLERANCE)
+      if (parser.seen_test('V')) {
+        #ifdef KINEMATIC_SEGMENT_TOLERANCE
+          report_kinematic_segments();
+        #endif
+        TERN_(DELTA_INCREMENTAL_IK, delta_line_ik.report());
+        return;
+      }
+    #endif
+
     if (parser.seenval('H')) delta_height              = parser.value_linear_units();
     if (parser.seenval('L')) delta_diagonal_rod        = parser.value_linear_units();
     if (parser.seenval('R')) delta_radius              = parser.value_linear_units();
@@ -96,10 +109,18 @@
    *
    *   A, P, and X are all aliases for the shoulder angle
    *   B, T, and Y are all aliases for the elbow angle
+   *
+   * With KINEMATIC_SEGMENT_TOLERANCE:
+   *
+   *   V                      - Report segmentation statistics
    */
   void GcodeSuite::M665() {
     if (!parser.seen_any()) return M665_report();
 
+    #ifdef KINEMATIC_SEGMENT_TOLERANCE
+      if (parser.seen_test('V')) return report_kinematic_segments();
+    #endif
+
     if (parser.seenval('S')) segments_per_second = parser.value_float();
 
     #if HAS_SCARA_OFFSET
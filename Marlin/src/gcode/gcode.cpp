@@ -65,6 +65,10 @@ GcodeSuite gcode;
   #include "../feature/password/password.h"
 #endif
 
+#if ENABLED(PLANNER_STARVATION_MONITOR)
+  #include "../feature/planner_monitor.h"
+#endif
+
 #include "../MarlinCore.h" // for idle, kill
 
 // Inactivity shutdown
@@ -163,20 +167,11 @@ int8_t GcodeSuite::get_target_e_stepper_from_command() {
 void GcodeSuite::get_destination_from_command() {
   xyze_bool_t seen{false};
 
-  #if ENABLED(CANCEL_OBJECTS)
-    const bool &skip_move = cancelable.skipping;
-  #else
-    constexpr bool skip_move = false;
-  #endif
-
   // Get new XYZ position, whether absolute or relative
   LOOP_LINEAR_AXES(i) {
     if ( (seen[i] = parser.seenval(AXIS_CHAR(i))) ) {
       const float v = parser.value_axis_units((AxisEnum)i);
-      if (skip_move)
-        destination[i] = current_position[i];
-      else
-        destination[i] = axis_is_relative(AxisEnum(i)) ? current_position[i] + v : LOGICAL_TO_NATIVE(v, i);
+      destination[i] = axis_is_relative(AxisEnum(i)) ? current_position[i] + v : LOGICAL_TO_NATIVE(v, i);
     }
     else
       destination[i] = current_position[i];
@@ -202,7 +197,7 @@ void GcodeSuite::get_destination_from_command() {
     feedrate_mm_s = parser.value_feedrate();
 
   #if ENABLED(PRINTCOUNTER)
-    if (!DEBUGGING(DRYRUN) && !skip_move)
+    if (!DEBUGGING(DRYRUN) && !TERN0(CANCEL_OBJECTS, cancelable.skipping))
       print_job_timer.incFilamentUsed(destination.e - current_position.e);
   #endif
 
@@ -226,6 +221,7 @@ void GcodeSuite::get_destination_from_command() {
  * Dwell waits immediately. It does not synchronize. Use M400 instead of G4
  */
 void GcodeSuite::dwell(millis_t time) {
+  TERN_(PLANNER_STARVATION_MONITOR, PlannerMonitor::Wait monitor_wait);
   time += millis();
   while (PENDING(millis(), time)) idle();
 }
@@ -599,6 +595,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 155: M155(); break;                                  // M155: Set temperature auto-report interval
       #endif
 
+      #if ENABLED(BINARY_TELEMETRY)
+        case 156: M156(); break;                                  // M156: Set binary telemetry interval
+      #endif
+
       #if ENABLED(PARK_HEAD_ON_PAUSE)
         case 125: M125(); break;                                  // M125: Store current position and move to filament change position
       #endif
@@ -617,6 +617,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         #endif
       #endif // BARICUDA
 
+      #if ENABLED(CRITICAL_SECTION_TRACE)
+        case 131: M131(); break;                                  // M131: Critical section report
+      #endif
+
+      #if ENABLED(EVENT_TRACE)
+        case 132: M132(); break;                                  // M132: Event trace dump
+      #endif
+
       #if ENABLED(PSU_CONTROL)
         case 80: M80(); break;                                    // M80: Turn on Power Supply
       #endif
@@ -734,6 +742,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 301: M301(); break;                                  // M301: Set hotend PID parameters
       #endif
 
+      #if ENABLED(MPCTEMP)
+        case 306: M306(); break;                                  // M306: MPC hotend model / autotune
+      #endif
+
       #if ENABLED(PIDTEMPBED)
         case 304: M304(); break;                                  // M304: Set bed PID parameters
       #endif
@@ -876,6 +888,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if ENABLED(PLANNER_STARVATION_MONITOR)
+        case 576: M576(); break;                                  // M576: Planner starvation report
+      #endif
+
       #if ENABLED(ADVANCED_PAUSE_FEATURE)
         case 600: M600(); break;                                  // M600: Pause for Filament Change
         case 603: M603(); break;                                  // M603: Configure Filament Change
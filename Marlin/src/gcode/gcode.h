@@ -149,6 +149,8 @@
  * M127 - Solenoid Air Valve Closed. (Requires BARICUDA)
  * M128 - EtoP Open. (Requires BARICUDA)
  * M129 - EtoP Closed. (Requires BARICUDA)
+ * M131 - Report critical section times, worst first. R to reset. (Requires CRITICAL_SECTION_TRACE)
+ * M132 - Send the event trace to the host. S0/S1 to pause/resume recording. (Requires EVENT_TRACE)
  * M140 - Set bed target temp. S<temp>
  * M141 - Set heated chamber target temp. S<temp> (Requires a chamber heater)
  * M143 - Set cooler target temp. S<temp> (Requires a laser cooling device)
@@ -157,6 +159,7 @@
  * M150 - Set Status LED Color as R<red> U<green> B<blue> W<white> P<bright>. Values 0-255. (Requires BLINKM, RGB_LED, RGBW_LED, NEOPIXEL_LED, PCA9533, or PCA9632).
  * M154 - Auto-report position with interval of S<seconds>. (Requires AUTO_REPORT_POSITION)
  * M155 - Auto-report temperatures with interval of S<seconds>. (Requires AUTO_REPORT_TEMPERATURES)
+ * M156 - Binary telemetry frames with interval of P<milliseconds>. (Requires BINARY_TELEMETRY)
  * M163 - Set a single proportion for a mixing extruder. (Requires MIXING_EXTRUDER)
  * M164 - Commit the mix and save to a virtual tool (current, or as specified by 'S'). (Requires MIXING_EXTRUDER)
  * M165 - Set the mix for the mixing extruder (and current virtual tool) with parameters ABCDHI. (Requires MIXING_EXTRUDER and DIRECT_MIXING_IN_G1)
@@ -200,6 +203,7 @@
  * M303 - PID relay autotune S<temperature> sets the target temperature. Default 150C. (Requires PIDTEMP)
  * M304 - Set bed PID parameters P I and D. (Requires PIDTEMPBED)
  * M305 - Set user thermistor parameters R T and P. (Requires TEMP_SENSOR_x 1000)
+ * M306 - Set MPC hotend model values, or autotune with T. (Requires MPCTEMP)
  * M309 - Set chamber PID parameters P I and D. (Requires PIDTEMPCHAMBER)
  * M350 - Set microstepping mode. (Requires digital microstepping pins.)
  * M351 - Toggle MS1 MS2 pins directly. (Requires digital microstepping pins.)
@@ -240,6 +244,7 @@
  * M554 - Get or set IP gateway. (Requires enabled Ethernet port)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
  * M575 - Change the serial baud rate. (Requires BAUD_RATE_GCODE)
+ * M576 - Report planner starvation. S<seconds> auto-report, L1 report each layer, R reset. (Requires PLANNER_STARVATION_MONITOR)
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
  * M605 - Set Dual X-Carriage movement mode: "M605 S<mode> [X<x_offset>] [R<temp_offset>]". (Requires DUAL_X_CARRIAGE)
@@ -733,6 +738,14 @@ private:
     #endif
   #endif
 
+  #if ENABLED(CRITICAL_SECTION_TRACE)
+    static void M131();
+  #endif
+
+  #if ENABLED(EVENT_TRACE)
+    static void M132();
+  #endif
+
   #if HAS_HEATED_BED
     static void M140_M190(const bool isM190);
     FORCE_INLINE static void M140() { M140_M190(false); }
@@ -771,6 +784,10 @@ private:
     static void M155();
   #endif
 
+  #if ENABLED(BINARY_TELEMETRY)
+    static void M156();
+  #endif
+
   #if ENABLED(MIXING_EXTRUDER)
     static void M163();
     static void M164();
@@ -882,6 +899,11 @@ private:
     static void M301_report(const bool forReplay=true E_OPTARG(const int8_t eindex=-1));
   #endif
 
+  #if ENABLED(MPCTEMP)
+    static void M306();
+    static void M306_report(const bool forReplay=true);
+  #endif
+
   #if ENABLED(PREVENT_COLD_EXTRUSION)
     static void M302();
   #endif
@@ -1027,6 +1049,10 @@ private:
     static void M575();
   #endif
 
+  #if ENABLED(PLANNER_STARVATION_MONITOR)
+    static void M576();
+  #endif
+
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
     static void M600();
     static void M603();
@@ -278,7 +278,7 @@ void GcodeSuite::D(const int16_t dcode) {
        * Usage: D576 [S<seconds>]
        *
        * With no parameters emits the following output:
-       * "D576 P<nn> B<nn> PU<nn> PD<nn> BU<nn> BD<nn>"
+       * "D576 P<nn> B<nn> PU<nn> PD<nn> BU<nn> BD<nn> PS<nn> BS<nn>"
        * Where:
        *   P : Planner buffers free
        *   B : Command buffers free
@@ -286,6 +286,8 @@ void GcodeSuite::D(const int16_t dcode) {
        *   PD: Longest duration (ms) the planner buffer was empty (since the last report)
        *   BU: Command buffer underruns (since the last report)
        *   BD: Longest duration (ms) command buffer was empty (since the last report)
+       *   PS: Total time (ms) the planner buffer was empty (since the last report)
+       *   BS: Total time (ms) the command buffer was empty (since the last report)
        */
       case 576: {
         if (parser.seenval('S'))
@@ -25,10 +25,20 @@
 
 /**
  * M110: Set Current Line Number
+ *
+ *   N<int>   The line number of the next command minus 1
+ *   W<int>   Lines the host may keep in flight. W0 for one "ok" per command. (Requires HOST_ACK_WINDOW)
+ *            Numbered lines sent after the "ok" for this command are acknowledged
+ *            on receipt with a single "ok N<last line> P<planner> B<buffer>" per batch.
  */
 void GcodeSuite::M110() {
 
   if (parser.seenval('N'))
     queue.set_current_line_number(parser.value_long());
 
+  #if ENABLED(HOST_ACK_WINDOW)
+    if (parser.seenval('W'))
+      SERIAL_ECHOLNPGM("ACK_WINDOW:", queue.set_ack_window(parser.value_byte()));
+  #endif
+
 }
@@ -91,6 +91,9 @@ void GcodeSuite::M115() {
     // AUTOREPORT_TEMP (M155)
     cap_line(PSTR("AUTOREPORT_TEMP"), ENABLED(AUTO_REPORT_TEMPERATURES));
 
+    // BINARY_TELEMETRY (M156)
+    cap_line(PSTR("BINARY_TELEMETRY"), ENABLED(BINARY_TELEMETRY));
+
     // PROGRESS (M530 S L, M531 <file>, M532 X L)
     cap_line(PSTR("PROGRESS"));
 
@@ -137,6 +140,9 @@ void GcodeSuite::M115() {
     // SD_WRITE (M928, M28, M29)
     cap_line(PSTR("SD_WRITE"), ENABLED(SDSUPPORT) && DISABLED(SDCARD_READONLY));
 
+    // COMPRESSED_GCODE (M23 opens heatshrink-compressed files)
+    cap_line(PSTR("COMPRESSED_GCODE"), ENABLED(SD_COMPRESSED_GCODE));
+
     // AUTOREPORT_SD_STATUS (M27 extension)
     cap_line(PSTR("AUTOREPORT_SD_STATUS"), ENABLED(AUTO_REPORT_SD_STATUS));
 
@@ -164,6 +170,9 @@ void GcodeSuite::M115() {
     // MEATPACK Compression
     cap_line(PSTR("MEATPACK"), SERIAL_IMPL.has_feature(port, SerialFeature::MeatPack));
 
+    // Windowed acknowledgement (M110 W)
+    cap_line(PSTR("ACK_WINDOW"), ENABLED(HOST_ACK_WINDOW));
+
     // Machine Geometry
     #if ENABLED(M115_GEOMETRY_REPORT)
       const xyz_pos_t bmin = { 0, 0, 0 },
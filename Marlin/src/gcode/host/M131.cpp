@@ -0,0 +1,47 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(CRITICAL_SECTION_TRACE)
+
+#include "../gcode.h"
+#include "../../feature/critical_trace.h"
+
+/**
+ * M131: Report critical section times
+ *
+ *   Lists each call site that disabled interrupts or held off the Stepper ISR,
+ *   with its worst and average time and count, worst first.
+ *   The LINUX HAL also writes the list to critical_trace.csv.
+ *
+ *   R  Clear the list after reporting
+ */
+void GcodeSuite::M131() {
+  critical_trace.report();
+  #ifdef __PLAT_LINUX__
+    critical_trace.write_csv("critical_trace.csv");
+  #endif
+  if (parser.seen_test('R')) critical_trace.reset();
+}
+
+#endif // CRITICAL_SECTION_TRACE
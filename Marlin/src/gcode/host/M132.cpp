@@ -0,0 +1,46 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(EVENT_TRACE)
+
+#include "../gcode.h"
+#include "../../feature/event_trace.h"
+
+/**
+ * M132: Send the event trace to the host
+ *
+ *   With no parameters, send the recorded events, oldest first, and clear the
+ *   trace. Capture the output and convert it with event_trace.py.
+ *
+ *   S0  Pause recording, e.g., to keep the events around a stall
+ *   S1  Resume recording
+ */
+void GcodeSuite::M132() {
+  if (parser.seen('S'))
+    event_trace.paused = !parser.value_bool();
+  else
+    event_trace.dump();
+}
+
+#endif // EVENT_TRACE
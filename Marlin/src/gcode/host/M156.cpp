@@ -0,0 +1,47 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(BINARY_TELEMETRY)
+
+#include "../gcode.h"
+#include "../../feature/binary_telemetry.h"
+
+/**
+ * M156: Set binary telemetry interval. M156 P<milliseconds>
+ *
+ *   P0 disables the stream. Frames go to the serial port that sent M156.
+ *   With no parameters, report the current interval.
+ */
+void GcodeSuite::M156() {
+
+  if (parser.seenval('P')) {
+    TERN_(HAS_MULTI_SERIAL, telemetry.port_mask = multiSerial.portMask);
+    telemetry.set_interval(parser.value_ushort());
+  }
+  else
+    SERIAL_ECHOLNPGM("Telemetry interval: ", telemetry.interval_ms, "ms");
+
+}
+
+#endif // BINARY_TELEMETRY
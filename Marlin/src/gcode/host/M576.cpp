@@ -0,0 +1,49 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PLANNER_STARVATION_MONITOR)
+
+#include "../gcode.h"
+#include "../../feature/planner_monitor.h"
+
+/**
+ * M576: Report planner starvation
+ *
+ *   Underruns are moves that started with nothing queued behind them, so they
+ *   had to slow to a stop. Lists the totals for the print, the current layer
+ *   and the worst layer so far.
+ *
+ *   S<seconds>  Report every S seconds. S0 to stop.
+ *   L<bool>     Report each layer as it finishes
+ *   R           Reset the counts
+ */
+void GcodeSuite::M576() {
+  bool report = true;
+  if (parser.seenval('S')) { planner_monitor.auto_reporter.set_interval(parser.value_byte()); report = false; }
+  if (parser.seen('L')) { planner_monitor.layer_reports = parser.value_bool(); report = false; }
+  if (report) planner_monitor.report();
+  if (parser.seen_test('R')) planner_monitor.reset();
+}
+
+#endif // PLANNER_STARVATION_MONITOR
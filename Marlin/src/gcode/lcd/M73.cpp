@@ -32,11 +32,16 @@
   #include "../../lcd/e3v2/enhanced/dwin.h"
 #endif
 
+#if ENABLED(REMAINING_TIME_ESTIMATE)
+  #include "../../feature/time_estimate.h"
+#endif
+
 /**
  * M73: Set percentage complete (for display on LCD)
  *
  * Example:
  *   M73 P25 ; Set progress to 25%
+ *   M73 R42 ; Set the slicer's remaining time to 42 minutes
  */
 void GcodeSuite::M73() {
 
@@ -57,6 +62,10 @@ void GcodeSuite::M73() {
     #endif
 
   #endif
+
+  #if ENABLED(REMAINING_TIME_ESTIMATE)
+    if (parser.seenval('R')) time_estimate.slicer_remaining(60 * parser.value_ulong());
+  #endif
 }
 
 #endif // LCD_SET_PROGRESS_MANUALLY
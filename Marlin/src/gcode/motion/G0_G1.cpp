@@ -35,6 +35,10 @@
   #include "../../module/stepper.h"
 #endif
 
+#if ENABLED(CANCEL_OBJECTS)
+  #include "../../feature/cancel_object.h"
+#endif
+
 extern xyze_pos_t destination;
 
 #if ENABLED(VARIABLE_G0_FEEDRATE)
@@ -103,11 +107,13 @@ void GcodeSuite::G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move/*=false*/)) {
 
     #endif // FWRETRACT
 
-    #if IS_SCARA
-      fast_move ? prepare_fast_move_to_destination() : prepare_line_to_destination();
-    #else
-      prepare_line_to_destination();
-    #endif
+    if (!TERN0(CANCEL_OBJECTS, cancelable.skip_move())) {  // Moves of a canceled object are only tracked
+      #if IS_SCARA
+        fast_move ? prepare_fast_move_to_destination() : prepare_line_to_destination();
+      #else
+        prepare_line_to_destination();
+      #endif
+    }
 
     #ifdef G0_FEEDRATE
       // Restore the motion mode feedrate
@@ -35,6 +35,10 @@
   #include "../../module/scara.h"
 #endif
 
+#if ENABLED(CANCEL_OBJECTS)
+  #include "../../feature/cancel_object.h"
+#endif
+
 #if N_ARC_CORRECTION < 1
   #undef N_ARC_CORRECTION
   #define N_ARC_CORRECTION 1
@@ -384,6 +388,10 @@ void GcodeSuite::G2_G3(const bool clockwise) {
 
     TERN_(SF_ARC_FIX, relative_mode = relative_mode_backup);
 
+    #if ENABLED(CANCEL_OBJECTS)
+      if (cancelable.skip_move()) return;           // Track the end of a canceled object's arc
+    #endif
+
     ab_float_t arc_offset = { 0, 0 };
     if (parser.seenval('R')) {
       const float r = parser.value_linear_units();
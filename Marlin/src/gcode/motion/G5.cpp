@@ -27,6 +27,10 @@
 #include "../../module/motion.h"
 #include "../../module/planner_bezier.h"
 
+#if ENABLED(CANCEL_OBJECTS)
+  #include "../../feature/cancel_object.h"
+#endif
+
 /**
  * Parameters interpreted according to:
  * https://linuxcnc.org/docs/2.7/html/gcode/g-code.html#gcode:g5
@@ -52,6 +56,10 @@ void GcodeSuite::G5() {
 
     get_destination_from_command();
 
+    #if ENABLED(CANCEL_OBJECTS)
+      if (cancelable.skip_move()) return;           // Track the end of a canceled object's curve
+    #endif
+
     const xy_pos_t offsets[2] = {
       { parser.linearval('I'), parser.linearval('J') },
       { parser.linearval('P'), parser.linearval('Q') }
@@ -57,6 +57,10 @@ GCodeQueue queue;
   #include "../feature/repeat.h"
 #endif
 
+#if ENABLED(EVENT_TRACE)
+  #include "../feature/event_trace.h"
+#endif
+
 // Frequently used G-code strings
 PGMSTR(G28_STR, "G28");
 
@@ -78,7 +82,9 @@ GCodeQueue::RingBuffer GCodeQueue::ring_buffer = { 0 };
   millis_t GCodeQueue::max_command_buffer_empty_duration = 0,
            GCodeQueue::max_planner_buffer_empty_duration = 0,
            GCodeQueue::command_buffer_empty_at = 0,
-           GCodeQueue::planner_buffer_empty_at = 0;
+           GCodeQueue::planner_buffer_empty_at = 0,
+           GCodeQueue::command_buffer_starved = 0,
+           GCodeQueue::planner_buffer_starved = 0;
 
   uint8_t GCodeQueue::auto_buffer_report_interval;
   millis_t GCodeQueue::next_buffer_report_ms;
@@ -275,10 +281,41 @@ void GCodeQueue::flush_and_request_resend(const serial_index_t serial_ind) {
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));   // Reply to the serial port that sent the command
   #endif
   SERIAL_FLUSH();
-  SERIAL_ECHOLNPGM(STR_RESEND, serial_state[serial_ind.index].last_N + 1);
+  SerialState &serial = serial_state[serial_ind.index];
+  SERIAL_ECHOLNPGM(STR_RESEND, serial.last_N + 1);
   SERIAL_ECHOLNPGM(STR_OK);
+  // The host goes back to the requested line and sends the whole window again
+  TERN_(HOST_ACK_WINDOW, serial.resend_pending = serial.ack_window > 0);
 }
 
+#if ENABLED(HOST_ACK_WINDOW)
+
+  uint8_t GCodeQueue::set_ack_window(const uint8_t lines) {
+    SerialState &serial = serial_state[ring_buffer.command_port().index];
+    serial.ack_window = _MIN(lines, HOST_ACK_WINDOW_MAX);
+    serial.acked_N = serial.last_N;
+    serial.resend_pending = false;
+    return serial.ack_window;
+  }
+
+  /**
+   * Acknowledge every numbered line queued since the last ack with a single
+   * "ok N<int> P<int> B<int>" giving the newest line number, planner space
+   * and command queue space. Hosts count only "ok N" lines towards the window.
+   */
+  void GCodeQueue::send_window_acks() {
+    LOOP_L_N(p, NUM_SERIAL) {
+      SerialState &serial = serial_state[p];
+      if (!serial.ack_window || serial.acked_N == serial.last_N) continue;
+      serial.acked_N = serial.last_N;
+      PORT_REDIRECT(SERIAL_PORTMASK(p));
+      SERIAL_ECHOPGM(STR_OK " N", serial.last_N);
+      SERIAL_ECHOLNPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, BUFSIZE - ring_buffer.length);
+    }
+  }
+
+#endif
+
 static bool serial_data_available(serial_index_t index) {
   const int a = SERIAL_IMPL.available(index);
   #if BOTH(RX_BUFFER_MONITOR, RX_BUFFER_SIZE)
@@ -469,6 +506,8 @@ void GCodeQueue::get_serial_commands() {
           const long gcode_N = strtol(npos + 1, nullptr, 10);
 
           if (gcode_N != serial.last_N + 1 && !M110) {
+            // Lines the host had in flight before the resend are dropped quietly
+            if (TERN0(HOST_ACK_WINDOW, serial.resend_pending)) continue;
             // In case of error on a serial port, don't prevent other serial port from making progress
             gcode_line_error(PSTR(STR_ERR_LINE_NO), p);
             break;
@@ -491,6 +530,7 @@ void GCodeQueue::get_serial_commands() {
           }
 
           serial.last_N = gcode_N;
+          TERN_(HOST_ACK_WINDOW, serial.resend_pending = false);
         }
         #if ENABLED(SDSUPPORT)
           // Pronterface "M29" and "M29 " has no line number
@@ -532,8 +572,9 @@ void GCodeQueue::get_serial_commands() {
           last_command_time = ms;
         #endif
 
-        // Add the command to the queue
-        ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
+        // Add the command to the queue. In a window numbered lines are acknowledged on receipt.
+        const bool skip_ok = TERN0(HOST_ACK_WINDOW, npos && serial.ack_window);
+        ring_buffer.enqueue(serial.line_buffer, skip_ok OPTARG(HAS_MULTI_SERIAL, p));
       }
       else
         process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count);
@@ -608,6 +649,8 @@ void GCodeQueue::get_available_commands() {
 
   get_serial_commands();
 
+  TERN_(HOST_ACK_WINDOW, send_window_acks());
+
   TERN_(SDSUPPORT, get_sdcard_commands());
 }
 
@@ -644,9 +687,12 @@ void GCodeQueue::advance() {
       command_buffer_empty = false;
       const millis_t command_buffer_empty_duration = millis() - command_buffer_empty_at;
       NOLESS(max_command_buffer_empty_duration, command_buffer_empty_duration);
+      command_buffer_starved += command_buffer_empty_duration;
     }
   #endif
 
+  TERN_(EVENT_TRACE, event_trace.record(EV_CMD_BEGIN, 0, ring_buffer.length));
+
   #if ENABLED(SDSUPPORT)
 
     if (card.flag.saving) {
@@ -655,6 +701,7 @@ void GCodeQueue::advance() {
         // M29 closes the file
         card.closefile();
         SERIAL_ECHOLNPGM(STR_FILE_SAVED);
+        TERN_(SD_STREAMING_UPLOAD, card.report_upload());
 
         #if !defined(__AVR__) || !defined(USBCON)
           #if ENABLED(SERIAL_STATS_DROPPED_RX)
@@ -685,6 +732,8 @@ void GCodeQueue::advance() {
 
   #endif // SDSUPPORT
 
+  TERN_(EVENT_TRACE, event_trace.record(EV_CMD_END, parser.command_letter, parser.codenum));
+
   // The queue may be reset by a command handler or by code invoked by idle() within a handler
   ring_buffer.advance_pos(ring_buffer.index_r, -1);
 }
@@ -692,12 +741,19 @@ void GCodeQueue::advance() {
 #if ENABLED(BUFFER_MONITORING)
 
   void GCodeQueue::report_buffer_statistics() {
+    // Count time spent in a still-open empty period up to now
+    const millis_t ms = millis();
+    if (planner_buffer_empty) { planner_buffer_starved += ms - planner_buffer_empty_at; planner_buffer_empty_at = ms; }
+    if (command_buffer_empty) { command_buffer_starved += ms - command_buffer_empty_at; command_buffer_empty_at = ms; }
+
     SERIAL_ECHOLNPGM("D576"
       " P:", planner.moves_free(),         " ", -queue.planner_buffer_underruns, " (", queue.max_planner_buffer_empty_duration, ")"
       " B:", BUFSIZE - ring_buffer.length, " ", -queue.command_buffer_underruns, " (", queue.max_command_buffer_empty_duration, ")"
+      " PS:", planner_buffer_starved, " BS:", command_buffer_starved
     );
     command_buffer_underruns = planner_buffer_underruns = 0;
     max_command_buffer_empty_duration = max_planner_buffer_empty_duration = 0;
+    command_buffer_starved = planner_buffer_starved = 0;
   }
 
   void GCodeQueue::auto_report_buffer_statistics() {
@@ -715,6 +771,7 @@ void GCodeQueue::advance() {
       planner_buffer_empty = false;
       const millis_t planner_buffer_empty_duration = ms - planner_buffer_empty_at;
       NOLESS(max_planner_buffer_empty_duration, planner_buffer_empty_duration); // if it's longer than the currently tracked max duration, replace it
+      planner_buffer_starved += planner_buffer_empty_duration;
     }
 
     if (queue.auto_buffer_report_interval && ELAPSED(ms, queue.next_buffer_report_ms)) {
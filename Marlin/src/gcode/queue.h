@@ -43,6 +43,11 @@ public:
     int count;                      //!< Number of characters read in the current line of serial input
     char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
     uint8_t input_state;            //!< The input state
+    #if ENABLED(HOST_ACK_WINDOW)
+      uint8_t ack_window;           //!< Numbered lines the host may keep in flight. 0 for one "ok" per command.
+      long acked_N;                 //!< The last line number acknowledged to the host
+      bool resend_pending;          //!< Quietly drop out-of-sequence lines until the requested line arrives
+    #endif
   };
 
   static SerialState serial_state[NUM_SERIAL]; //!< Serial states for each serial port
@@ -197,6 +202,15 @@ public:
    */
   static inline void set_current_line_number(long n) { serial_state[ring_buffer.command_port().index].last_N = n; }
 
+  #if ENABLED(HOST_ACK_WINDOW)
+    /**
+     * Set the number of lines the host on the current port may keep in flight.
+     * Numbered lines are then acknowledged on receipt, one "ok N<int>" per batch.
+     * Returns the window actually applied.
+     */
+    static uint8_t set_ack_window(const uint8_t lines);
+  #endif
+
   #if ENABLED(BUFFER_MONITORING)
 
     private:
@@ -207,7 +221,8 @@ public:
     static uint32_t command_buffer_underruns, planner_buffer_underruns;
     static bool command_buffer_empty, planner_buffer_empty;
     static millis_t max_command_buffer_empty_duration, max_planner_buffer_empty_duration,
-                    command_buffer_empty_at, planner_buffer_empty_at;
+                    command_buffer_empty_at, planner_buffer_empty_at,
+                    command_buffer_starved, planner_buffer_starved;
 
     /**
      * Report buffer statistics to the host to be able to detect buffer underruns
@@ -219,6 +234,8 @@ public:
      *  PD<uint>  Max time in ms the planner buffer was empty since last report
      *  BU<uint>  Number of command buffer underruns since last report
      *  BD<uint>  Max time in ms the command buffer was empty since last report
+     *  PS<uint>  Total time in ms the planner buffer was empty since last report
+     *  BS<uint>  Total time in ms the command buffer was empty since last report
      */
     static void report_buffer_statistics();
 
@@ -241,6 +258,10 @@ private:
 
   static void get_serial_commands();
 
+  #if ENABLED(HOST_ACK_WINDOW)
+    static void send_window_acks();
+  #endif
+
   #if ENABLED(SDSUPPORT)
     static void get_sdcard_commands();
   #endif
@@ -31,6 +31,8 @@
  * M27: Get SD Card status
  *      OR, with 'S<seconds>' set the SD status auto-report interval. (Requires AUTO_REPORT_SD_STATUS)
  *      OR, with 'C' get the current filename.
+ *      OR, with 'T' report SD read throughput. Add 'R' to reset the counters. (Requires SD_EXTENT_CACHE)
+ *                  The last upload's throughput is also shown. (Requires SD_STREAMING_UPLOAD)
  */
 void GcodeSuite::M27() {
   if (parser.seen_test('C')) {
@@ -39,6 +41,20 @@ void GcodeSuite::M27() {
     return;
   }
 
+  #if EITHER(SD_EXTENT_CACHE, SD_STREAMING_UPLOAD)
+    if (parser.seen_test('T')) {
+      #if ENABLED(SD_EXTENT_CACHE)
+        const sd_read_stats_t &rs = SdVolume::readStats;
+        const float kb = rs.blocks * 0.5f,
+                    kbps = rs.usec ? kb * 1000000.0f / rs.usec : 0;
+        SERIAL_ECHOLNPGM("SD read: ", kb, "KB in ", rs.usec / 1000, "ms (", kbps, "KB/s) reads:", rs.commands, " FAT:", rs.fatReads);
+        if (parser.seen_test('R')) SdVolume::resetReadStats();
+      #endif
+      TERN_(SD_STREAMING_UPLOAD, card.report_upload());
+      return;
+    }
+  #endif
+
   #if ENABLED(AUTO_REPORT_SD_STATUS)
     if (parser.seenval('S')) {
       card.auto_reporter.set_interval(parser.value_byte());
@@ -26,8 +26,13 @@
 #include "../../libs/duration_t.h"
 #include "../../lcd/marlinui.h"
 
+#if ENABLED(REMAINING_TIME_ESTIMATE)
+  #include "../../feature/time_estimate.h"
+#endif
+
 /**
  * M31: Get the time since the start of SD Print (or last M109)
+ *      With REMAINING_TIME_ESTIMATE also report the time left, once known.
  */
 void GcodeSuite::M31() {
   char buffer[22];
@@ -36,4 +41,11 @@ void GcodeSuite::M31() {
   ui.set_status(buffer);
 
   SERIAL_ECHO_MSG("Print time: ", buffer);
+
+  #if ENABLED(REMAINING_TIME_ESTIMATE)
+    if (const uint32_t left = time_estimate.remaining()) {
+      duration_t(left).toString(buffer);
+      SERIAL_ECHO_MSG("Remaining time: ", buffer);
+    }
+  #endif
 }
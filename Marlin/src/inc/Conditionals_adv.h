@@ -91,6 +91,7 @@
   #undef TEMP_SENSOR_7
   #undef FWRETRACT
   #undef PIDTEMP
+  #undef MPCTEMP
   #undef AUTOTEMP
   #undef PID_EXTRUSION_SCALING
   #undef LIN_ADVANCE
@@ -950,7 +951,7 @@
 #endif
 
 // Flag whether hex_print.cpp is used
-#if ANY(AUTO_BED_LEVELING_UBL, M100_FREE_MEMORY_WATCHER, DEBUG_GCODE_PARSER, TMC_DEBUG, MARLIN_DEV_MODE)
+#if ANY(AUTO_BED_LEVELING_UBL, M100_FREE_MEMORY_WATCHER, DEBUG_GCODE_PARSER, TMC_DEBUG, MARLIN_DEV_MODE, EVENT_TRACE)
   #define NEED_HEX_PRINT 1
 #endif
 
@@ -297,6 +297,20 @@
   #undef SLOWDOWN
 #endif
 
+#if DISABLED(SLOWDOWN)
+  #undef SLOWDOWN_BY_TIME
+#endif
+
+// The planner keeps a running total of the time in the buffer
+#if EITHER(HAS_WIRED_LCD, SLOWDOWN_BY_TIME)
+  #define HAS_BLOCK_BUFFER_RUNTIME 1
+#endif
+
+// Block durations from the trapezoid, for the remaining time and the offline estimator
+#if EITHER(REMAINING_TIME_ESTIMATE, PRINT_TIME_ESTIMATOR)
+  #define HAS_BLOCK_TIME 1
+#endif
+
 #ifndef MESH_INSET
   #define MESH_INSET 0
 #endif
@@ -2440,7 +2454,7 @@
 #if !HAS_TEMP_SENSOR
   #undef AUTO_REPORT_TEMPERATURES
 #endif
-#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION)
+#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, BINARY_TELEMETRY, PLANNER_STARVATION_MONITOR)
   #define HAS_AUTO_REPORTING 1
 #endif
 
@@ -3049,6 +3063,9 @@
 #if ENABLED(SEGMENT_LEVELED_MOVES) && !defined(LEVELED_SEGMENT_LENGTH)
   #define LEVELED_SEGMENT_LENGTH 5
 #endif
+#if ENABLED(SEGMENT_LEVELED_MOVES) && !IS_KINEMATIC && EITHER(MESH_BED_LEVELING, AUTO_BED_LEVELING_BILINEAR)
+  #define HAS_LEVELED_SEGMENTS 1
+#endif
 
 /**
  * Default mesh area is an area with an inset margin on the print area.
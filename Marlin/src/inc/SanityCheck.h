@@ -697,6 +697,34 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "SERIAL_XON_XOFF and SERIAL_STATS_* features not supported on USB-native AVR devices."
 #endif
 
+#if ENABLED(HOST_ACK_WINDOW) && !WITHIN(HOST_ACK_WINDOW_MAX, 1, 255)
+  #error "HOST_ACK_WINDOW_MAX must be from 1 to 255."
+#endif
+
+#if ENABLED(BINARY_TELEMETRY) && !WITHIN(BINARY_TELEMETRY_MIN_INTERVAL, 1, 65535)
+  #error "BINARY_TELEMETRY_MIN_INTERVAL must be from 1 to 65535."
+#endif
+
+#if ENABLED(CRITICAL_SECTION_TRACE) && !WITHIN(CRITICAL_TRACE_SITES, 1, 255)
+  #error "CRITICAL_TRACE_SITES must be from 1 to 255."
+#endif
+
+#if ENABLED(EVENT_TRACE) && !(WITHIN(EVENT_TRACE_SIZE, 16, 8192) && IS_POWER_OF_2(EVENT_TRACE_SIZE))
+  #error "EVENT_TRACE_SIZE must be a power of 2 from 16 to 8192."
+#endif
+
+#if ENABLED(SLOWDOWN_BY_TIME) && !WITHIN(SLOWDOWN_BUFFER_MS, 10, 1000)
+  #error "SLOWDOWN_BUFFER_MS must be from 10 to 1000."
+#endif
+
+#if ENABLED(REMAINING_TIME_ESTIMATE) && NONE(SDSUPPORT, LCD_SET_PROGRESS_MANUALLY)
+  #error "REMAINING_TIME_ESTIMATE requires SDSUPPORT or LCD_SET_PROGRESS_MANUALLY (for M73 R)."
+#endif
+
+#if ENABLED(PRINT_TIME_ESTIMATOR) && !defined(__PLAT_LINUX__)
+  #error "PRINT_TIME_ESTIMATOR is only for the LINUX native build."
+#endif
+
 /**
  * Multiple Stepper Drivers Per Axis
  */
@@ -1351,6 +1379,16 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "You must set DISPLAY_CHARSET_HD44780 to JAPANESE, WESTERN or CYRILLIC for your LCD controller."
 #endif
 
+/**
+ * Hotend Heating Options - PID vs Model Predictive Control
+ */
+#if ENABLED(MPCTEMP)
+  #if ENABLED(PIDTEMP)
+    #error "To use MPCTEMP you must disable PIDTEMP."
+  #endif
+  static_assert(WITHIN(MPC_SMOOTHING_FACTOR, 0, 1), "MPC_SMOOTHING_FACTOR must be from 0.0 to 1.0.");
+#endif
+
 /**
  * Bed Heating Options - PID vs Limit Switching
  */
@@ -1644,6 +1682,18 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "Probes need Z_AFTER_PROBING >= 0."
   #endif
 
+  #if ENABLED(PROBE_FAST_MULTI)
+    #if TOTAL_PROBING != 2
+      #error "PROBE_FAST_MULTI requires MULTIPLE_PROBING 2 without EXTRA_PROBING."
+    #elif !IS_CARTESIAN || IS_CORE || ENABLED(MARKFORGED_XY)
+      #error "PROBE_FAST_MULTI requires a Cartesian machine with its own Z motors."
+    #elif EITHER(SENSORLESS_PROBING, MEASURE_BACKLASH_WHEN_PROBING)
+      #error "PROBE_FAST_MULTI is not compatible with SENSORLESS_PROBING or MEASURE_BACKLASH_WHEN_PROBING."
+    #elif !(PROBE_FAST_TRUST > 0 && PROBE_FAST_RECHECK > 0)
+      #error "PROBE_FAST_TRUST and PROBE_FAST_RECHECK must be 1 or more."
+    #endif
+  #endif
+
   #if MULTIPLE_PROBING > 0 || EXTRA_PROBING > 0
     #if MULTIPLE_PROBING == 0
       #error "EXTRA_PROBING requires MULTIPLE_PROBING."
@@ -1762,6 +1812,31 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+#if ENABLED(DELTA_INCREMENTAL_IK)
+  #if DISABLED(DELTA)
+    #error "DELTA_INCREMENTAL_IK requires DELTA."
+  #elif ENABLED(SKEW_CORRECTION)
+    #error "DELTA_INCREMENTAL_IK is not compatible with SKEW_CORRECTION."
+  #endif
+  static_assert(WITHIN(DELTA_IK_RESYNC, 2, 1000), "DELTA_IK_RESYNC must be between 2 and 1000.");
+#endif
+
+#ifdef KINEMATIC_SEGMENT_TOLERANCE
+  #if !EITHER(DELTA, IS_SCARA)
+    #error "KINEMATIC_SEGMENT_TOLERANCE requires DELTA or a SCARA."
+  #endif
+  static_assert(KINEMATIC_SEGMENT_TOLERANCE > 0, "KINEMATIC_SEGMENT_TOLERANCE must be greater than 0.");
+  static_assert(KINEMATIC_SEGMENT_MIN_LENGTH > 0, "KINEMATIC_SEGMENT_MIN_LENGTH must be greater than 0.");
+  static_assert(KINEMATIC_SEGMENT_MIN_RATE >= 0, "KINEMATIC_SEGMENT_MIN_RATE must be 0 or more.");
+#endif
+
+#ifdef LEVELED_SEGMENT_TOLERANCE
+  #if !HAS_LEVELED_SEGMENTS
+    #error "LEVELED_SEGMENT_TOLERANCE requires SEGMENT_LEVELED_MOVES with MESH_BED_LEVELING or AUTO_BED_LEVELING_BILINEAR on a Cartesian machine."
+  #endif
+  static_assert(LEVELED_SEGMENT_TOLERANCE > 0, "LEVELED_SEGMENT_TOLERANCE must be greater than 0.");
+#endif
+
 #if ENABLED(MESH_EDIT_GFX_OVERLAY) && !(ENABLED(AUTO_BED_LEVELING_UBL) && EITHER(HAS_MARLINUI_U8GLIB, IS_DWIN_MARLINUI))
   #error "MESH_EDIT_GFX_OVERLAY requires AUTO_BED_LEVELING_UBL and a Graphical LCD."
 #endif
@@ -2036,6 +2111,13 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "TEMP_SENSOR_REDUNDANT 1000 requires REDUNDANT_PULLUP_RESISTOR_OHMS, REDUNDANT_RESISTANCE_25C_OHMS and REDUNDANT_BETA in Configuration_adv.h."
 #endif
 
+/**
+ * Fast thermistor conversion builds its tables with C++14 constexpr
+ */
+#if ENABLED(FAST_THERMISTOR_CONVERSION) && __cplusplus < 201402L
+  #error "FAST_THERMISTOR_CONVERSION requires a C++14 compiler (not available for AVR)."
+#endif
+
 /**
  * Required MAX31865 settings
  */
@@ -2642,6 +2724,17 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+#if ENABLED(SD_EXTENT_CACHE) && !WITHIN(SD_EXTENT_CACHE_SIZE, 1, 255)
+  #error "SD_EXTENT_CACHE_SIZE must be from 1 to 255."
+#endif
+#if ENABLED(SD_STREAMING_UPLOAD)
+  #if !WITHIN(SD_UPLOAD_BUFFER_BLOCKS, 1, 32)
+    #error "SD_UPLOAD_BUFFER_BLOCKS must be from 1 to 32."
+  #elif !WITHIN(SD_UPLOAD_PREALLOCATE, 0, 16384)
+    #error "SD_UPLOAD_PREALLOCATE must be from 0 to 16384."
+  #endif
+#endif
+
 #if ENABLED(SD_IGNORE_AT_STARTUP)
   #if ENABLED(POWER_LOSS_RECOVERY)
     #error "SD_IGNORE_AT_STARTUP is incompatible with POWER_LOSS_RECOVERY."
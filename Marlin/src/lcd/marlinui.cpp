@@ -62,6 +62,10 @@ MarlinUI ui;
   #include "../module/printcounter.h"
 #endif
 
+#if ENABLED(EVENT_TRACE)
+  #include "../feature/event_trace.h"
+#endif
+
 #if LCD_HAS_WAIT_FOR_MOVE
   bool MarlinUI::wait_for_move; // = false
 #endif
@@ -1073,6 +1077,8 @@ constexpr uint8_t epps = ENCODER_PULSES_PER_STEP;
 
         TERN_(HAS_ADC_BUTTONS, keypad_buttons = 0);
 
+        TERN_(EVENT_TRACE, event_trace.record(EV_UI_BEGIN));
+
         #if HAS_MARLINUI_U8GLIB
 
           #if ENABLED(LIGHTWEIGHT_UI)
@@ -1100,6 +1106,7 @@ constexpr uint8_t epps = ENCODER_PULSES_PER_STEP;
             if (drawing_screen && (drawing_screen = u8g.nextPage())) {
               if (on_status_screen())
                 NOLESS(max_display_update_time, millis() - ms);
+              TERN_(EVENT_TRACE, event_trace.record(EV_UI_END, 1));
               return;
             }
           }
@@ -1115,6 +1122,8 @@ constexpr uint8_t epps = ENCODER_PULSES_PER_STEP;
 
         TERN_(HAS_LCD_MENU, lcd_clicked = false);
 
+        TERN_(EVENT_TRACE, event_trace.record(EV_UI_END));
+
         // Keeping track of the longest time for an individual LCD update.
         // Used to do screen throttling when the planner starts to fill up.
         if (on_status_screen())
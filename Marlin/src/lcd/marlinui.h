@@ -38,6 +38,10 @@
   #include "tft_io/touch_calibration.h"
 #endif
 
+#if ENABLED(REMAINING_TIME_ESTIMATE)
+  #include "../feature/time_estimate.h"
+#endif
+
 #if ANY(HAS_LCD_MENU, ULTIPANEL_FEEDMULTIPLY, SOFT_RESET_ON_KILL)
   #define HAS_ENCODER_ACTION 1
 #endif
@@ -296,6 +300,7 @@ public:
       static void progress_reset() { if (progress_override & (PROGRESS_MASK + 1U)) set_progress(0); }
       #if ENABLED(SHOW_REMAINING_TIME)
         static inline uint32_t _calculated_remaining_time() {
+          TERN_(REMAINING_TIME_ESTIMATE, if (const uint32_t r = time_estimate.remaining()) return r);
           const duration_t elapsed = print_job_timer.duration();
           const progress_t progress = _get_progress();
           return progress ? elapsed.value * (100 * (PROGRESS_SCALE) - progress) / progress : 0;
@@ -303,7 +308,9 @@ public:
         #if ENABLED(USE_M73_REMAINING_TIME)
           static uint32_t remaining_time;
           FORCE_INLINE static void set_remaining_time(const uint32_t r) { remaining_time = r; }
-          FORCE_INLINE static uint32_t get_remaining_time() { return remaining_time ?: _calculated_remaining_time(); }
+          FORCE_INLINE static uint32_t get_remaining_time() {
+            return TERN0(REMAINING_TIME_ESTIMATE, time_estimate.remaining()) ?: remaining_time ?: _calculated_remaining_time();
+          }
           FORCE_INLINE static void reset_remaining_time() { set_remaining_time(0); }
         #else
           FORCE_INLINE static uint32_t get_remaining_time() { return _calculated_remaining_time(); }
@@ -32,6 +32,10 @@
   #include "../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(CRITICAL_SECTION_TRACE)
+  #include "../feature/critical_trace.h"
+#endif
+
 Buzzer::state_t Buzzer::state;
 CircularQueue<tone_t, TONE_QUEUE_LENGTH> Buzzer::buffer;
 Buzzer buzzer;
@@ -67,11 +71,15 @@ void Buzzer::tick() {
     if (state.tone.frequency > 0) {
       #if ENABLED(EXTENSIBLE_UI) && DISABLED(EXTUI_LOCAL_BEEPER)
         CRITICAL_SECTION_START();
+        TERN_(CRITICAL_SECTION_TRACE, TRACE_ISRS_OFF());
         ExtUI::onPlayTone(state.tone.frequency, state.tone.duration);
+        TERN_(CRITICAL_SECTION_TRACE, TRACE_ISRS_ON());
         CRITICAL_SECTION_END();
       #elif ENABLED(SPEAKER)
         CRITICAL_SECTION_START();
+        TERN_(CRITICAL_SECTION_TRACE, TRACE_ISRS_OFF());
         ::tone(BEEPER_PIN, state.tone.frequency, state.tone.duration);
+        TERN_(CRITICAL_SECTION_TRACE, TRACE_ISRS_ON());
         CRITICAL_SECTION_END();
       #else
         on();
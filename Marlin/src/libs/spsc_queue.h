@@ -0,0 +1,113 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "../inc/MarlinConfigPre.h"
+#include "../core/types.h"
+
+/**
+ * Hand a value over to the other side of an ISR / main loop (or thread) split.
+ * Everything written before store_release() is seen by whoever reads the value
+ * with load_acquire(). On a single core this is only a compiler barrier, on
+ * Cortex-M3 it adds a DMB, and on x86 plain moves already have this ordering.
+ */
+template<typename T>
+FORCE_INLINE void store_release(volatile T &var, const T val) { __atomic_store_n(&var, val, __ATOMIC_RELEASE); }
+
+template<typename T>
+FORCE_INLINE T load_acquire(const volatile T &var) { return __atomic_load_n(&var, __ATOMIC_ACQUIRE); }
+
+/**
+ * @brief   Lock-free single-producer / single-consumer ring buffer
+ * @details One side only pushes and the other only pops, for example a serial
+ *          RX interrupt and the main loop. Each index is written by one side
+ *          only, so neither side needs to disable interrupts. The producer
+ *          publishes an item by advancing 'head' after storing it, and the
+ *          consumer frees a slot by advancing 'tail' after reading it.
+ *
+ *          The indexes run freely and are masked on access, so all N slots
+ *          are usable. N must be a power of 2.
+ */
+template<typename T, uint16_t N>
+class SPSCQueue {
+  static_assert(N && !(N & (N - 1)), "SPSCQueue size must be a power of 2.");
+  #ifdef __AVR__
+    static_assert(N <= 128, "SPSCQueue on AVR is limited to 128 items for single-byte indexes.");
+  #endif
+
+  public:
+    typedef typename IF<(N > 128), uint16_t, uint8_t>::type index_t;
+
+    SPSCQueue() : head(0), tail(0) {}
+
+    // Either side
+
+    index_t count() const { return index_t(load_acquire(head) - load_acquire(tail)); }
+    index_t free() const  { return N - count(); }
+    bool empty() const    { return count() == 0; }
+    bool full() const     { return count() == N; }
+    static constexpr index_t size() { return N; }
+
+    // Producer side
+
+    /**
+     * @brief   Add an item, if there is room
+     * @return  true if the item was added
+     */
+    bool push(const T &item) {
+      const index_t h = head;
+      if (index_t(h - load_acquire(tail)) == N) return false;
+      buffer[h & (N - 1)] = item;
+      store_release(head, index_t(h + 1));
+      return true;
+    }
+
+    // Consumer side
+
+    /**
+     * @brief   Get the oldest item without removing it
+     * @return  true if there was an item
+     */
+    bool peek(T &item) const {
+      const index_t t = tail;
+      if (load_acquire(head) == t) return false;
+      item = buffer[t & (N - 1)];
+      return true;
+    }
+
+    /**
+     * @brief   Remove the oldest item
+     * @return  true if there was an item
+     */
+    bool pop(T &item) {
+      if (!peek(item)) return false;
+      store_release(tail, index_t(tail + 1));
+      return true;
+    }
+
+    // Drop all queued items. Only the consumer may call this.
+    void clear() { store_release(tail, load_acquire(head)); }
+
+  private:
+    T buffer[N];
+    volatile index_t head, tail;
+};
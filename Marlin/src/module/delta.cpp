@@ -117,6 +117,135 @@ void inverse_kinematics(const xyz_pos_t &raw) {
   #endif
 }
 
+#if ENABLED(DELTA_INCREMENTAL_IK)
+
+  DeltaLineIK delta_line_ik;
+
+  uint16_t DeltaLineIK::remaining, // = 0
+           DeltaLineIK::since_sync;
+  xy_pos_t DeltaLineIK::pos;
+  xy_float_t DeltaLineIK::step;
+  float DeltaLineIK::ddr;
+  abc_float_t DeltaLineIK::r, DeltaLineIK::dr, DeltaLineIK::y, DeltaLineIK::y_prev;
+  uint32_t DeltaLineIK::fast_count, // = 0
+           DeltaLineIK::exact_count; // = 0
+
+  // Largest Newton correction (1 - r * y^2) trusted. The result is then within ~4e-7 of the root.
+  #define DELTA_IK_MAX_CORRECTION 0.001f
+
+  // Start the recurrences from the exact radicands at raw
+  void DeltaLineIK::seed(const xy_pos_t &raw) {
+    xy_pos_t xy = raw;
+    TERN_(HAS_HOTEND_OFFSET, xy -= hotend_offset[active_extruder]);
+    LOOP_ABC(t) {
+      const xy_float_t u = delta_tower[t] - xy;
+      r[t] = delta_diagonal_rod_2_tower[t] - HYPOT2(u.x, u.y);
+      dr[t] = 2 * (u.x * step.x + u.y * step.y) + 0.5f * ddr;
+      y[t] = RSQRT(r[t]);
+      // First-order estimate for one segment back
+      y_prev[t] = y[t] * (1 + 0.5f * (dr[t] - ddr) * sq(y[t]));
+    }
+    since_sync = 0;
+  }
+
+  // Use the exact IK for this segment and restart from there
+  void DeltaLineIK::sync(const xyz_pos_t &raw) {
+    seed(raw);
+    LOOP_ABC(t) delta[t] = raw.z + r[t] * y[t];
+    exact_count++;
+  }
+
+  void DeltaLineIK::start(const xy_pos_t &raw, const xy_float_t &step_xy, const uint16_t count) {
+    remaining = count;
+    if (!count) return;
+    step = step_xy;
+    ddr = -2 * HYPOT2(step.x, step.y);
+    seed(raw);
+    pos = raw + step;
+  }
+
+  bool DeltaLineIK::next(const xyz_pos_t &raw) {
+    if (!remaining) return false;
+
+    // A move from somewhere else, e.g., a manual move queued by idle()
+    if (ABS(raw.x - pos.x) > 0.001f || ABS(raw.y - pos.y) > 0.001f) {
+      remaining = 0;
+      return false;
+    }
+
+    remaining--;
+    pos += step;
+
+    if (++since_sync >= DELTA_IK_RESYNC) {
+      sync(raw);
+      return true;
+    }
+
+    LOOP_ABC(t) {
+      r[t] += dr[t];
+      dr[t] += ddr;
+      const float yx = 2 * y[t] - y_prev[t],  // Linear extrapolation
+                  c = 1 - r[t] * sq(yx);
+      if (!WITHIN(c, -(DELTA_IK_MAX_CORRECTION), DELTA_IK_MAX_CORRECTION)) {
+        sync(raw);
+        return true;
+      }
+      y_prev[t] = y[t];
+      y[t] = yx + 0.5f * yx * c;
+      delta[t] = raw.z + r[t] * y[t];
+    }
+    fast_count++;
+    return true;
+  }
+
+  void DeltaLineIK::report() {
+    SERIAL_ECHOLNPGM("Incremental IK segments:", fast_count, " Exact:", exact_count);
+  }
+
+#endif // DELTA_INCREMENTAL_IK
+
+#ifdef KINEMATIC_SEGMENT_TOLERANCE
+
+  /**
+   * The steppers move the carriages linearly from one segment end to the next,
+   * so at the middle of a segment of length h each carriage is off by h^2/8 times
+   * the second derivative of its height along the line. The effector moves by the
+   * inverse Jacobian of that, and only the part across the line bends the path.
+   *
+   * With R = L^2 - |u|^2 and u the tower's XY offset from the effector,
+   * each carriage is at z + sqrt(R), its Jacobian row is [u.x, u.y, sqrt(R)] / sqrt(R),
+   * and its second derivative along the line is -(|dir.xy|^2 + (u.dir)^2 / R) / sqrt(R).
+   */
+  float segment_bow(const xyz_pos_t &raw, const xyz_float_t &dir) {
+    xy_pos_t xy = raw;
+    TERN_(HAS_HOTEND_OFFSET, xy -= hotend_offset[active_extruder]);
+
+    const float dir_xy2 = HYPOT2(dir.x, dir.y);
+    xy_float_t g[ABC];  // dq/dx and dq/dy for each tower, dq/dz being 1
+    abc_float_t ddq;    // Second derivative of each carriage height along the line
+    LOOP_ABC(t) {
+      const xy_float_t u = delta_tower[t] - xy;
+      const float inv_q = RSQRT(delta_diagonal_rod_2_tower[t] - HYPOT2(u.x, u.y)),
+                  w = (u.x * dir.x + u.y * dir.y) * inv_q;
+      g[t] = u * inv_q;
+      ddq[t] = -(dir_xy2 + sq(w)) * inv_q;
+    }
+
+    // Solve J e = ddq. Taking tower A from B and C removes Z.
+    const xy_float_t gb = g[B_AXIS] - g[A_AXIS], gc = g[C_AXIS] - g[A_AXIS];
+    const float bb = ddq.b - ddq.a, bc = ddq.c - ddq.a,
+                inv_det = 1.0f / (gb.x * gc.y - gb.y * gc.x);
+    xyz_float_t e;
+    e.x = (bb * gc.y - bc * gb.y) * inv_det;
+    e.y = (gb.x * bc - gc.x * bb) * inv_det;
+    e.z = ddq.a - g[A_AXIS].x * e.x - g[A_AXIS].y * e.y;
+
+    const float along = e.x * dir.x + e.y * dir.y + e.z * dir.z;
+    return 0.125f * SQRT(_MAX(0.0f, NORMSQ(e.x, e.y, e.z) - sq(along)));
+  }
+
+#endif
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
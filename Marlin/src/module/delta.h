@@ -76,6 +76,63 @@ void recalc_delta_settings();
 
 void inverse_kinematics(const xyz_pos_t &raw);
 
+#if ENABLED(DELTA_INCREMENTAL_IK)
+
+  /**
+   * Incremental inverse kinematics for the segments of a straight move
+   *
+   * Along a line the square of each carriage's height above the effector,
+   * R = L^2 - dx^2 - dy^2, is a quadratic in the segment number, so it is
+   * stepped by forward differences with two additions. Its reciprocal root
+   * is extrapolated from the previous two segments and refined with one
+   * Newton step, y = y * (1.5 - 0.5 * R * y^2), then the height is R * y.
+   * No sqrt() or division is needed.
+   *
+   * The exact IK restarts the recurrences every DELTA_IK_RESYNC segments,
+   * whenever the Newton step has to make a large correction (long segments
+   * near the edge of the workspace), and for the final segment of a move.
+   *
+   * start() arms the next 'count' calls of next(), made by the planner for
+   * each segment. Each must be one 'step' further along from 'raw'. A call
+   * for any other position disarms it and falls back to the exact IK.
+   */
+  class DeltaLineIK {
+  public:
+    static void start(const xy_pos_t &raw, const xy_float_t &step, const uint16_t count);
+    static void stop() { remaining = 0; }
+
+    // Set 'delta' for the next segment. Return false to use the exact IK instead.
+    static bool next(const xyz_pos_t &raw);
+
+    static void report();
+    static uint32_t fast_segments() { return fast_count; }
+    static uint32_t exact_segments() { return exact_count; }
+
+  private:
+    static uint16_t remaining, since_sync;
+    static xy_pos_t pos;              // Expected raw XY of the next segment
+    static xy_float_t step;
+    static float ddr;                 // Second difference of each radicand, -2 |step|^2
+    static abc_float_t r, dr,         // Radicand and its first difference
+                       y, y_prev;     // 1 / sqrt(r) now and one segment back
+    static uint32_t fast_count, exact_count;
+
+    static void seed(const xy_pos_t &raw);
+    static void sync(const xyz_pos_t &raw);
+  };
+
+  extern DeltaLineIK delta_line_ik;
+
+#endif
+
+#ifdef KINEMATIC_SEGMENT_TOLERANCE
+  /**
+   * How far a segment through 'raw' along the unit vector 'dir' bows away
+   * from the straight line, in mm per mm^2 of segment length.
+   */
+  float segment_bow(const xyz_pos_t &raw, const xyz_float_t &dir);
+#endif
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
@@ -877,6 +877,51 @@ void restore_feedrate_and_scaling() {
 
 #endif // !HAS_SOFTWARE_ENDSTOPS
 
+#ifdef KINEMATIC_SEGMENT_TOLERANCE
+
+  uint32_t kinematic_segment_count, // = 0
+           kinematic_segment_timed; // = 0
+
+  /**
+   * The segment count for a kinematic move from 'start' by 'diff', lasting 'seconds'.
+   * The bow of a segment grows with the square of its length, so the count that keeps
+   * the move within KINEMATIC_SEGMENT_TOLERANCE of a straight line follows from the
+   * worst bow per mm^2 at five points along the move. Aiming 5% under the tolerance
+   * covers the bow changing between those points. Where a delta rod is within ~15
+   * degrees of flat, or a SCARA arm is nearly straight, the bow changes too fast
+   * within one segment and the tolerance is only approximate.
+   *
+   * Never fewer than KINEMATIC_SEGMENT_MIN_RATE per second, so no block outlasts
+   * 1 / KINEMATIC_SEGMENT_MIN_RATE seconds. 'timed' is the count from
+   * segments-per-second, kept for comparison by M665 V.
+   */
+  uint16_t kinematic_segments(const xyz_pos_t &start, const xyz_float_t &diff, const uint16_t timed, const_float_t seconds) {
+    kinematic_segment_timed += timed;
+
+    const float mm = diff.magnitude();
+    float bow = 0;
+    if (!UNEAR_ZERO(mm)) {
+      const xyz_float_t dir = diff * (1.0f / mm);
+      LOOP_L_N(i, 5) NOLESS(bow, segment_bow(start + diff * (0.25f * i), dir));
+    }
+
+    const float n = _MIN(mm * SQRT(bow * (1.0f / (0.95f * (KINEMATIC_SEGMENT_TOLERANCE)))),
+                         mm * (1.0f / (KINEMATIC_SEGMENT_MIN_LENGTH))),
+                least = seconds * (KINEMATIC_SEGMENT_MIN_RATE);
+    const uint16_t segments = _MAX(1U, uint16_t(_MIN(CEIL(_MAX(n, least)), 65535.0f)));
+    kinematic_segment_count += segments;
+    return segments;
+  }
+
+  void report_kinematic_segments() {
+    SERIAL_ECHOPGM("Kinematic segments:", kinematic_segment_count, " By time:", kinematic_segment_timed);
+    if (kinematic_segment_timed)
+      SERIAL_ECHOPAIR_F(" Ratio:", float(kinematic_segment_count) / kinematic_segment_timed, 3);
+    SERIAL_EOL();
+  }
+
+#endif
+
 #if !UBL_SEGMENTED
 
 FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
@@ -959,6 +1004,11 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     // At least one segment is required
     NOLESS(segments, 1U);
 
+    #ifdef KINEMATIC_SEGMENT_TOLERANCE
+      // Instead, only as many as the kinematics need to stay near the line
+      segments = kinematic_segments(current_position, diff, segments, seconds);
+    #endif
+
     // The approximate length of each segment
     const float inv_segments = 1.0f / float(segments),
                 cartesian_segment_mm = cartesian_mm * inv_segments;
@@ -979,6 +1029,9 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     // Get the current position as starting point
     xyze_pos_t raw = current_position;
 
+    // Step the tower heights along the line instead of solving each segment
+    TERN_(DELTA_INCREMENTAL_IK, delta_line_ik.start(raw, segment_distance, segments - 1));
+
     // Calculate and execute the segments
     millis_t next_idle_ms = millis() + 200UL;
     while (--segments) {
@@ -987,6 +1040,8 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
       if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, cartesian_segment_mm OPTARG(SCARA_FEEDRATE_SCALING, inv_duration))) break;
     }
 
+    TERN_(DELTA_INCREMENTAL_IK, delta_line_ik.stop());
+
     // Ensure last segment arrives at target location.
     planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, cartesian_segment_mm OPTARG(SCARA_FEEDRATE_SCALING, inv_duration));
 
@@ -997,6 +1052,114 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
 
   #if ENABLED(SEGMENT_LEVELED_MOVES)
 
+    #if HAS_LEVELED_SEGMENTS
+      uint32_t leveled_segment_count; // = 0
+      float leveled_segment_mm; // = 0
+    #endif
+
+    #ifdef LEVELED_SEGMENT_TOLERANCE
+
+      #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+        #define LEVELED_SEGMENT_Z(P) bilinear_z_offset(P)
+        #define LEVELED_SUBCELLS TERN(ABL_BILINEAR_SUBDIVISION, BILINEAR_SUBDIVISIONS, 1)
+      #else
+        #define LEVELED_SEGMENT_Z(P) mbl.get_z(P)
+        #define LEVELED_SUBCELLS 1
+      #endif
+
+      /**
+       * Walk the grid lines crossed by a move along one axis, in order of increasing
+       * fraction of the move. Only line indexes 0 to 'cells' bound interpolation cells.
+       */
+      struct GridLineWalk {
+        float g0, inv_dg;
+        int16_t i, last, step;
+        void init(const_float_t start, const_float_t end, const_float_t origin, const_float_t spacing, const int16_t cells) {
+          g0 = (start - origin) / spacing;
+          const float g1 = (end - origin) / spacing;
+          if (g1 > g0) {
+            step = 1; i = _MAX(int16_t(FLOOR(g0)) + 1, 0); last = _MIN(int16_t(CEIL(g1)) - 1, cells);
+          }
+          else {
+            step = -1; i = _MIN(int16_t(CEIL(g0)) - 1, cells); last = _MAX(int16_t(FLOOR(g1)) + 1, 0);
+          }
+          inv_dg = g1 != g0 ? 1.0f / (g1 - g0) : 0;
+          if (!inv_dg) last = i - step;               // No motion on this axis, so no crossings
+        }
+        bool done() const { return step > 0 ? i > last : i < last; }
+        float t() const { return done() ? 1.0f : (i - g0) * inv_dg; }
+        void next() { i += step; }
+      };
+
+      /**
+       * Split a leveled move only where it crosses a mesh line, then split each piece
+       * just enough that the interpolated Z stays within LEVELED_SEGMENT_TOLERANCE of
+       * a straight chord. Along a line inside one cell the bilinear Z is quadratic, so
+       * its largest deviation from the chord is at the midpoint, and shrinks with the
+       * square of the number of equal sub-segments.
+       */
+      inline void segmented_line_to_destination(const_feedRate_t fr_mm_s) {
+
+        const xyze_float_t diff = destination - current_position;
+
+        // If the move is only in Z/E don't split up the move
+        if (!diff.x && !diff.y) {
+          planner.buffer_line(destination, fr_mm_s);
+          return;
+        }
+
+        const float cartesian_mm = diff.magnitude();
+        if (UNEAR_ZERO(cartesian_mm)) return;
+        leveled_segment_mm += cartesian_mm;
+
+        constexpr int16_t cells_x = (GRID_MAX_CELLS_X) * (LEVELED_SUBCELLS),
+                          cells_y = (GRID_MAX_CELLS_Y) * (LEVELED_SUBCELLS);
+        const xy_float_t origin = { _GET_MESH_X(0), _GET_MESH_Y(0) },
+                         spacing = { (_GET_MESH_X(GRID_MAX_CELLS_X) - origin.x) / cells_x,
+                                     (_GET_MESH_Y(GRID_MAX_CELLS_Y) - origin.y) / cells_y };
+
+        GridLineWalk wx, wy;
+        wx.init(current_position.x, destination.x, origin.x, spacing.x, cells_x);
+        wy.init(current_position.y, destination.y, origin.y, spacing.y, cells_y);
+
+        const xyze_pos_t start = current_position;
+        const xy_pos_t start_xy = start;
+        const xy_float_t diff_xy = diff;
+        auto mesh_z = [&](const_float_t t) { return LEVELED_SEGMENT_Z(start_xy + diff_xy * t); };
+
+        millis_t next_idle_ms = millis() + 200UL;
+        float t0 = 0, z0 = mesh_z(0);
+        for (;;) {
+          // The next grid line crossing, or the end of the move
+          const float tx = wx.t(), ty = wy.t(), t1 = _MIN(tx, ty);
+          if (tx == t1) wx.next();
+          if (ty == t1) wy.next();
+
+          // Sub-segments needed to stay within tolerance of the mesh
+          const float z1 = mesh_z(t1),
+                      dev = ABS(z0 + z1 - 2 * mesh_z((t0 + t1) * 0.5f)) * 0.5f,
+                      dt = t1 - t0;
+          const uint16_t pieces = _MAX(1U, uint16_t(CEIL(SQRT(dev * (1.0f / (LEVELED_SEGMENT_TOLERANCE))))));
+          const float piece_mm = cartesian_mm * dt / pieces;
+
+          for (uint16_t n = 1; n <= pieces; ++n) {
+            segment_idle(next_idle_ms);
+            leveled_segment_count++;
+            if (t1 >= 1.0f && n == pieces) {
+              // The final move must be to the exact destination
+              planner.buffer_line(destination, fr_mm_s, active_extruder, piece_mm);
+              return;
+            }
+            const xyze_pos_t raw = start + diff * (t0 + dt * n / pieces);
+            if (!planner.buffer_line(raw, fr_mm_s, active_extruder, piece_mm)) return;
+          }
+
+          t0 = t1; z0 = z1;
+        }
+      }
+
+    #else
+
     /**
      * Prepare a segmented move on a CARTESIAN setup.
      *
@@ -1039,6 +1202,11 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
       //SERIAL_ECHOLNPGM(" segments=", segments);
       //SERIAL_ECHOLNPGM(" segment_mm=", cartesian_segment_mm);
 
+      #if HAS_LEVELED_SEGMENTS
+        leveled_segment_count += segments;
+        leveled_segment_mm += cartesian_mm;
+      #endif
+
       // Get the raw current position as starting point
       xyze_pos_t raw = current_position;
 
@@ -1055,6 +1223,8 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
       planner.buffer_line(destination, fr_mm_s, active_extruder, cartesian_segment_mm OPTARG(SCARA_FEEDRATE_SCALING, inv_duration));
     }
 
+    #endif // !LEVELED_SEGMENT_TOLERANCE
+
   #endif // SEGMENT_LEVELED_MOVES
 
   /**
@@ -51,6 +51,17 @@ extern xyze_pos_t current_position,  // High-level current tool position
 // Scratch space for a cartesian result
 extern xyz_pos_t cartes;
 
+// Leveled move segmentation statistics, reported by M420 V
+#if HAS_LEVELED_SEGMENTS
+  extern uint32_t leveled_segment_count;
+  extern float leveled_segment_mm;
+#endif
+
+#ifdef KINEMATIC_SEGMENT_TOLERANCE
+  uint16_t kinematic_segments(const xyz_pos_t &start, const xyz_float_t &diff, const uint16_t timed, const_float_t seconds);
+  void report_kinematic_segments();
+#endif
+
 // Until kinematics.cpp is created, declare this here
 #if IS_KINEMATIC
   extern abce_pos_t delta;
@@ -111,6 +111,14 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(EVENT_TRACE)
+  #include "../feature/event_trace.h"
+#endif
+
+#if ENABLED(PLANNER_STARVATION_MONITOR)
+  #include "../feature/planner_monitor.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_FOR_1ST_MOVE 100
@@ -234,7 +242,7 @@ float Planner::previous_nominal_speed_sqr;
   xyze_pos_t Planner::position_cart;
 #endif
 
-#if HAS_WIRED_LCD
+#if HAS_BLOCK_BUFFER_RUNTIME
   volatile uint32_t Planner::block_buffer_runtime_us = 0;
 #endif
 
@@ -725,7 +733,7 @@ void Planner::init() {
  */
 block_t* Planner::get_current_block() {
   // Get the number of moves in the planner queue so far
-  const uint8_t nr_moves = movesplanned();
+  const uint8_t nr_moves = BLOCK_MOD(load_acquire(block_buffer_head) - block_buffer_tail);
 
   // If there are any moves queued ...
   if (nr_moves) {
@@ -746,7 +754,7 @@ block_t* Planner::get_current_block() {
     if (TEST(block->flag, BLOCK_BIT_RECALCULATE)) return nullptr;
 
     // We can't be sure how long an active block will take, so don't count it.
-    TERN_(HAS_WIRED_LCD, block_buffer_runtime_us -= block->segment_time_us);
+    TERN_(HAS_BLOCK_BUFFER_RUNTIME, block_buffer_runtime_us -= block->segment_time_us);
 
     // As this block is busy, advance the nonbusy block pointer
     block_buffer_nonbusy = next_block_index(block_buffer_tail);
@@ -760,7 +768,7 @@ block_t* Planner::get_current_block() {
   }
 
   // The queue became empty
-  TERN_(HAS_WIRED_LCD, clear_block_buffer_runtime()); // paranoia. Buffer is empty now - so reset accumulated time to zero.
+  TERN_(HAS_BLOCK_BUFFER_RUNTIME, clear_block_buffer_runtime()); // paranoia. Buffer is empty now - so reset accumulated time to zero.
 
   return nullptr;
 }
@@ -1183,13 +1191,6 @@ void Planner::recalculate_trapezoids() {
             const float current_nominal_speed = SQRT(block->nominal_speed_sqr),
                         nomr = 1.0f / current_nominal_speed;
             calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
-            #if ENABLED(LIN_ADVANCE)
-              if (block->use_advance_lead) {
-                const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
-                block->max_adv_steps = current_nominal_speed * comp;
-                block->final_adv_steps = next_entry_speed * comp;
-              }
-            #endif
           }
 
           // Reset current only to ensure next trapezoid is computed - The
@@ -1222,13 +1223,6 @@ void Planner::recalculate_trapezoids() {
       const float next_nominal_speed = SQRT(next->nominal_speed_sqr),
                   nomr = 1.0f / next_nominal_speed;
       calculate_trapezoid_for_block(next, next_entry_speed * nomr, float(MINIMUM_PLANNER_SPEED) * nomr);
-      #if ENABLED(LIN_ADVANCE)
-        if (next->use_advance_lead) {
-          const float comp = next->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
-          next->max_adv_steps = next_nominal_speed * comp;
-          next->final_adv_steps = (MINIMUM_PLANNER_SPEED) * comp;
-        }
-      #endif
     }
 
     // Reset next only to ensure its trapezoid is computed - The stepper is free to use
@@ -1663,7 +1657,7 @@ void Planner::quick_stop() {
   // forced to empty, there's no risk the ISR will touch this.
   delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
 
-  #if HAS_WIRED_LCD
+  #if HAS_BLOCK_BUFFER_RUNTIME
     // Clear the accumulated runtime
     clear_block_buffer_runtime();
   #endif
@@ -1766,6 +1760,7 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
  * Block until all buffered steps are executed / cleaned
  */
 void Planner::synchronize() {
+  TERN_(PLANNER_STARVATION_MONITOR, PlannerMonitor::Wait monitor_wait);
   while (has_blocks_queued() || cleaning_buffer_counter
       || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
   ) idle();
@@ -1820,8 +1815,10 @@ bool Planner::_buffer_steps(const xyze_long_t &target
     delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
   }
 
+  TERN_(EVENT_TRACE, event_trace.record(EV_BLOCK_QUEUED, block_buffer_head, BLOCK_MOD(next_buffer_head - block_buffer_tail)));
+
   // Move buffer head
-  block_buffer_head = next_buffer_head;
+  store_release(block_buffer_head, next_buffer_head);
 
   // Recalculate and optimize trapezoidal speed profiles
   recalculate();
@@ -2251,7 +2248,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   const uint8_t moves_queued = nonbusy_movesplanned();
 
   // Slow down when the buffer starts to empty, rather than wait at the corner for a buffer refill
-  #if EITHER(SLOWDOWN, HAS_WIRED_LCD) || defined(XY_FREQUENCY_LIMIT)
+  #if EITHER(SLOWDOWN, HAS_BLOCK_BUFFER_RUNTIME) || defined(XY_FREQUENCY_LIMIT)
     // Segment time im micro seconds
     int32_t segment_time_us = LROUND(1000000.0f / inverse_secs);
   #endif
@@ -2260,20 +2257,36 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     #ifndef SLOWDOWN_DIVISOR
       #define SLOWDOWN_DIVISOR 2
     #endif
+  #endif
+
+  #if ENABLED(SLOWDOWN_BY_TIME)
+    // Once the buffer is less than half full, slow down when less than SLOWDOWN_BUFFER_MS of
+    // motion is queued behind the busy block. A segment that long refills the buffer by itself.
+    // Shorter ones are stretched by up to double their time as the buffer drains, so the host
+    // or SD can catch up.
+    if (WITHIN(moves_queued, 2, (BLOCK_BUFFER_SIZE) / (SLOWDOWN_DIVISOR) - 1) && segment_time_us < (SLOWDOWN_BUFFER_MS) * 1000L) {
+      const int16_t shortfall_ms = (SLOWDOWN_BUFFER_MS) - _MIN(block_buffer_runtime(), uint16_t(SLOWDOWN_BUFFER_MS));
+      if (shortfall_ms > 0) {
+        const int32_t nst = segment_time_us + segment_time_us * shortfall_ms / (SLOWDOWN_BUFFER_MS);
+        inverse_secs = 1000000.0f / nst;
+        segment_time_us = nst;
+      }
+    }
+  #elif ENABLED(SLOWDOWN)
     if (WITHIN(moves_queued, 2, (BLOCK_BUFFER_SIZE) / (SLOWDOWN_DIVISOR) - 1)) {
       const int32_t time_diff = settings.min_segment_time_us - segment_time_us;
       if (time_diff > 0) {
         // Buffer is draining so add extra time. The amount of time added increases if the buffer is still emptied more.
         const int32_t nst = segment_time_us + LROUND(2 * time_diff / moves_queued);
         inverse_secs = 1000000.0f / nst;
-        #if defined(XY_FREQUENCY_LIMIT) || HAS_WIRED_LCD
+        #if defined(XY_FREQUENCY_LIMIT) || HAS_BLOCK_BUFFER_RUNTIME
           segment_time_us = nst;
         #endif
       }
     }
   #endif
 
-  #if HAS_WIRED_LCD
+  #if HAS_BLOCK_BUFFER_RUNTIME
     // Protect the access to the position.
     const bool was_enabled = stepper.suspend();
 
@@ -2428,7 +2441,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
                               && de > 0;
 
       if (block->use_advance_lead) {
-        block->e_D_ratio = (target_float.e - position_float.e) /
+        const float e_D_ratio = (target_float.e - position_float.e) /
           #if IS_KINEMATIC
             block->millimeters
           #else
@@ -2440,10 +2453,10 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
         // Check for unusual high e_D ratio to detect if a retract move was combined with the last print move due to min. steps per segment. Never execute this with advance!
         // This assumes no one will use a retract length of 0mm < retr_length < ~0.2mm and no one will print 100mm wide lines using 3mm filament or 35mm wide lines using 1.75mm filament.
-        if (block->e_D_ratio > 3.0f)
+        if (e_D_ratio > 3.0f)
           block->use_advance_lead = false;
         else {
-          const uint32_t max_accel_steps_per_s2 = MAX_E_JERK(extruder) / (extruder_advance_K[active_extruder] * block->e_D_ratio) * steps_per_mm;
+          const uint32_t max_accel_steps_per_s2 = MAX_E_JERK(extruder) / (extruder_advance_K[active_extruder] * e_D_ratio) * steps_per_mm;
           if (TERN0(LA_DEBUG, accel > max_accel_steps_per_s2))
             SERIAL_ECHOLNPGM("Acceleration limited.");
           NOMORE(accel, max_accel_steps_per_s2);
@@ -2481,14 +2494,14 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     block->acceleration_rate = (uint32_t)(accel * (sq(4096.0f) / (STEPPER_TIMER_RATE)));
   #endif
   #if ENABLED(LIN_ADVANCE)
+    /**
+     * The pressure advance in E steps is K * (E speed in steps/s). Both speeds scale
+     * with the block step rate, so the Stepper derives the advance at any point of
+     * the trapezoid, and across junctions, from the step rate and this factor alone.
+     */
     if (block->use_advance_lead) {
-      block->advance_speed = (STEPPER_TIMER_RATE) / (extruder_advance_K[active_extruder] * block->e_D_ratio * block->acceleration * settings.axis_steps_per_mm[E_AXIS_N(extruder)]);
-      #if ENABLED(LA_DEBUG)
-        if (extruder_advance_K[active_extruder] * block->e_D_ratio * block->acceleration * 2 < SQRT(block->nominal_speed_sqr) * block->e_D_ratio)
-          SERIAL_ECHOLNPGM("More than 2 steps per eISR loop executed.");
-        if (block->advance_speed < 200)
-          SERIAL_ECHOLNPGM("eISR running at > 10kHz.");
-      #endif
+      const float advance_factor = extruder_advance_K[active_extruder] * block->steps.e / block->step_event_count;
+      block->advance_factor = _MIN(advance_factor, 255.0f) * float(1UL << 24);
     }
   #endif
 
@@ -2859,7 +2872,7 @@ void Planner::buffer_sync_block(TERN_(LASER_SYNCHRONOUS_M106_M107, uint8_t sync_
     delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
   }
 
-  block_buffer_head = next_buffer_head;
+  store_release(block_buffer_head, next_buffer_head);
 
   stepper.wake_up();
 } // buffer_sync_block()
@@ -2989,6 +3002,8 @@ bool Planner::buffer_segment(const abce_pos_t &abce
 bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder/*=active_extruder*/, const float millimeters/*=0.0*/
   OPTARG(SCARA_FEEDRATE_SCALING, const_float_t inv_duration/*=0.0*/)
 ) {
+  TERN_(PLANNER_STARVATION_MONITOR, planner_monitor.line_queued(cart.z, cart.e));
+
   xyze_pos_t machine = cart;
   TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
 
@@ -3010,7 +3025,8 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, cons
     const float mm = millimeters ?: (cart_dist_mm.x || cart_dist_mm.y) ? cart_dist_mm.magnitude() : TERN0(HAS_Z_AXIS, ABS(cart_dist_mm.z));
 
     // Cartesian XYZ to kinematic ABC, stored in global 'delta'
-    inverse_kinematics(machine);
+    if (TERN1(DELTA_INCREMENTAL_IK, !delta_line_ik.next(machine)))
+      inverse_kinematics(machine);
 
     #if ENABLED(SCARA_FEEDRATE_SCALING)
       // For SCARA scale the feed rate from mm/s to degrees/s
@@ -3082,8 +3098,10 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, cons
       delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
     }
 
+    TERN_(EVENT_TRACE, event_trace.record(EV_BLOCK_QUEUED, block_buffer_head, BLOCK_MOD(next_buffer_head - block_buffer_tail)));
+
     // Move buffer head
-    block_buffer_head = next_buffer_head;
+    store_release(block_buffer_head, next_buffer_head);
 
     stepper.enable_all_steppers();
     stepper.wake_up();
@@ -3259,7 +3277,7 @@ void Planner::set_max_feedrate(const uint8_t axis, float inMaxFeedrateMMS) {
 
 #endif
 
-#if HAS_WIRED_LCD
+#if HAS_BLOCK_BUFFER_RUNTIME
 
   uint16_t Planner::block_buffer_runtime() {
     #ifdef __AVR__
@@ -3300,3 +3318,31 @@ void Planner::set_max_feedrate(const uint8_t axis, float inMaxFeedrateMMS) {
   }
 
 #endif
+
+#if HAS_BLOCK_TIME
+
+  float Planner::block_time(const block_t * const block) {
+    if (block->flag & BLOCK_MASK_SYNC) return 0;
+
+    // A block still waiting for its trapezoid runs at its nominal rate
+    if (TEST(block->flag, BLOCK_BIT_RECALCULATE) || !block->acceleration_steps_per_s2)
+      return block->step_event_count / float(_MAX(block->nominal_rate, uint32_t(MINIMAL_STEP_RATE)));
+
+    // Accelerate to the peak rate, cruise there, then decelerate. Without a cruise
+    // phase the peak is wherever the acceleration ends.
+    const float accel = block->acceleration_steps_per_s2,
+                initial_rate = block->initial_rate, final_rate = block->final_rate;
+    const uint32_t cruise_steps = block->decelerate_after - block->accelerate_until;
+    const float peak_rate = cruise_steps ? float(block->nominal_rate)
+                                         : SQRT(sq(initial_rate) + 2 * accel * block->accelerate_until);
+    return (2 * peak_rate - initial_rate - final_rate) / accel + cruise_steps / peak_rate;
+  }
+
+  float Planner::queued_time() {
+    float total = 0;
+    for (uint8_t b = block_buffer_nonbusy; b != block_buffer_head; b = next_block_index(b))
+      total += block_time(&block_buffer[b]);
+    return total;
+  }
+
+#endif
@@ -45,6 +45,7 @@
 
 #include "motion.h"
 #include "../gcode/queue.h"
+#include "../libs/spsc_queue.h"
 
 #if ENABLED(DELTA)
   #include "delta.h"
@@ -163,8 +164,31 @@ enum BlockFlag : char {
  */
 typedef struct block_t {
 
+  // Byte-sized fields come first and share one word. Keep the rest grouped by size
+  // so the block has no padding holes.
+
   volatile uint8_t flag;                    // Block flags (See BlockFlag enum above) - Modified by ISR and main thread!
 
+  axis_bits_t direction_bits;               // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
+
+  #if HAS_MULTI_EXTRUDER
+    uint8_t extruder;                       // The extruder to move (if E move)
+  #else
+    static constexpr uint8_t extruder = 0;
+  #endif
+
+  #if ENABLED(LIN_ADVANCE)
+    bool use_advance_lead;                  // Apply pressure advance to this block
+  #endif
+
+  #if HAS_FAN
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
+
+  #if ENABLED(BARICUDA)
+    uint8_t valve_pressure, e_to_p_pressure;
+  #endif
+
   // Fields used by the motion planner to manage acceleration
   float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
         entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
@@ -178,16 +202,6 @@ typedef struct block_t {
   };
   uint32_t step_event_count;                // The number of step events required to complete this block
 
-  #if HAS_MULTI_EXTRUDER
-    uint8_t extruder;                       // The extruder to move (if E move)
-  #else
-    static constexpr uint8_t extruder = 0;
-  #endif
-
-  #if ENABLED(MIXING_EXTRUDER)
-    mixer_comp_t b_color[MIXING_STEPPERS];  // Normalized color for the mixing steppers
-  #endif
-
   // Settings for the trapezoid generator
   uint32_t accelerate_until,                // The index of the step event on which to stop acceleration
            decelerate_after;                // The index of the step event on which to start decelerating
@@ -202,15 +216,9 @@ typedef struct block_t {
     uint32_t acceleration_rate;             // The acceleration rate used for acceleration calculation
   #endif
 
-  axis_bits_t direction_bits;               // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
-
   // Advance extrusion
   #if ENABLED(LIN_ADVANCE)
-    bool use_advance_lead;
-    uint16_t advance_speed,                 // STEP timer value for extruder speed offset ISR
-             max_adv_steps,                 // max. advance steps to get cruising speed pressure (not always nominal_speed!)
-             final_adv_steps;               // advance steps due to exit speed
-    float e_D_ratio;
+    uint32_t advance_factor;                // Advance steps per step/s of the block, as a 8.24 fixed-point value
   #endif
 
   uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
@@ -218,28 +226,24 @@ typedef struct block_t {
            final_rate,                      // The minimal rate at exit
            acceleration_steps_per_s2;       // acceleration steps/sec^2
 
-  #if ENABLED(DIRECT_STEPPING)
-    page_idx_t page_idx;                    // Page index used for direct stepping
-  #endif
-
-  #if HAS_CUTTER
-    cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
+  #if HAS_BLOCK_BUFFER_RUNTIME
+    uint32_t segment_time_us;
   #endif
 
-  #if HAS_FAN
-    uint8_t fan_speed[FAN_COUNT];
+  #if ENABLED(POWER_LOSS_RECOVERY)
+    uint32_t sdpos;
   #endif
 
-  #if ENABLED(BARICUDA)
-    uint8_t valve_pressure, e_to_p_pressure;
+  #if ENABLED(MIXING_EXTRUDER)
+    mixer_comp_t b_color[MIXING_STEPPERS];  // Normalized color for the mixing steppers
   #endif
 
-  #if HAS_WIRED_LCD
-    uint32_t segment_time_us;
+  #if ENABLED(DIRECT_STEPPING)
+    page_idx_t page_idx;                    // Page index used for direct stepping
   #endif
 
-  #if ENABLED(POWER_LOSS_RECOVERY)
-    uint32_t sdpos;
+  #if HAS_CUTTER
+    cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
   #endif
 
   #if ENABLED(LASER_POWER_INLINE)
@@ -333,6 +337,8 @@ class Planner {
      *  Reader of tail is Stepper::isr(). Always consider tail busy / read-only
      */
     static block_t block_buffer[BLOCK_BUFFER_SIZE];
+    // The main loop publishes blocks by advancing head and the Stepper ISR frees them by
+    // advancing tail, each with store_release(), so neither side needs a critical section.
     static volatile uint8_t block_buffer_head,      // Index of the next block to be pushed
                             block_buffer_nonbusy,   // Index of the first non busy block
                             block_buffer_planned,   // Index of the optimally planned block
@@ -467,7 +473,7 @@ class Planner {
       static last_move_t g_uc_extruder_last_move[E_STEPPERS];
     #endif
 
-    #if HAS_WIRED_LCD
+    #if HAS_BLOCK_BUFFER_RUNTIME
       volatile static uint32_t block_buffer_runtime_us; // Theoretical block buffer runtime in µs
     #endif
 
@@ -680,7 +686,7 @@ class Planner {
     #endif // HAS_POSITION_MODIFIERS
 
     // Number of moves currently in the planner including the busy block, if any
-    FORCE_INLINE static uint8_t movesplanned() { return BLOCK_MOD(block_buffer_head - block_buffer_tail); }
+    FORCE_INLINE static uint8_t movesplanned() { return BLOCK_MOD(block_buffer_head - load_acquire(block_buffer_tail)); }
 
     // Number of nonbusy moves currently in the planner
     FORCE_INLINE static uint8_t nonbusy_movesplanned() { return BLOCK_MOD(block_buffer_head - block_buffer_nonbusy); }
@@ -896,14 +902,23 @@ class Planner {
      */
     FORCE_INLINE static void release_current_block() {
       if (has_blocks_queued())
-        block_buffer_tail = next_block_index(block_buffer_tail);
+        store_release(block_buffer_tail, next_block_index(block_buffer_tail));
     }
 
-    #if HAS_WIRED_LCD
+    #if HAS_BLOCK_BUFFER_RUNTIME
       static uint16_t block_buffer_runtime();
       static void clear_block_buffer_runtime();
     #endif
 
+    #if HAS_BLOCK_TIME
+      /**
+       * The time a block takes to run through its trapezoid, in seconds,
+       * and the total for the blocks waiting behind the one now running.
+       */
+      static float block_time(const block_t * const block);
+      static float queued_time();
+    #endif
+
     #if ENABLED(AUTOTEMP)
       static celsius_t autotemp_min, autotemp_max;
       static float autotemp_factor;
@@ -44,6 +44,11 @@
   #include "../feature/bedlevel/bedlevel.h"
 #endif
 
+#if ENABLED(PROBE_FAST_MULTI)
+  #include "planner.h"
+  #include "stepper.h"
+#endif
+
 #if ENABLED(DELTA)
   #include "delta.h"
 #endif
@@ -98,6 +103,12 @@ xyz_pos_t Probe::offset; // Initialized by settings.load()
   Probe::sense_bool_t Probe::test_sensitivity;
 #endif
 
+#if ENABLED(PROBE_FAST_MULTI)
+  float Probe::trigger_z;
+  uint8_t Probe::fast_pairs, Probe::fast_only_count;      // Agreeing double-probes, fast-only probes since the last check
+  float Probe::fast_diff_min, Probe::fast_diff_max, Probe::fast_diff_sum;
+#endif
+
 #if ENABLED(Z_PROBE_SLED)
 
   #ifndef SLED_DOCKING_OFFSET
@@ -405,6 +416,8 @@ bool Probe::set_deployed(const bool deploy) {
 
   if (endstops.z_probe_enabled == deploy) return false;
 
+  TERN_(PROBE_FAST_MULTI, fast_pairs = fast_only_count = 0); // Each deployment proves the fast probe again
+
   // Make room for probe to deploy (or stow)
   // Fix-mounted probe should only raise for deploy
   // unless PAUSE_BEFORE_DEPLOY_STOW is enabled
@@ -475,9 +488,17 @@ bool Probe::set_deployed(const bool deploy) {
  *          (according to the Z stepper count). The float Z is propagated
  *          back to the planner.position to preempt any rounding error.
  *
+ *          With PROBE_FAST_MULTI a 'raise' is queued behind the probing move and
+ *          starts as soon as the probe triggers. current_position.z is left at
+ *          the top of the raise and the trigger height goes into trigger_z.
+ *
  * @return TRUE if the probe failed to trigger.
  */
-bool Probe::probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s) {
+#if ENABLED(PROBE_FAST_MULTI)
+  bool Probe::probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s, const_float_t raise/*=0*/) {
+#else
+  bool Probe::probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s) {
+#endif
   DEBUG_SECTION(log_probe, "Probe::probe_down_to_z", DEBUGGING(LEVELING));
 
   #if BOTH(HAS_HEATED_BED, WAIT_FOR_BED_HEATER)
@@ -505,7 +526,18 @@ bool Probe::probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s) {
   TERN_(HAS_QUIET_PROBING, set_probing_paused(true));
 
   // Move down until the probe is triggered
-  do_blocking_move_to_z(z, fr_mm_s);
+  #if ENABLED(PROBE_FAST_MULTI)
+    if (raise) {
+      // The endstop only discards the probing move, so the raise goes on without a stop
+      current_position.z = z;
+      line_to_current_position(fr_mm_s);
+      current_position.z += raise;
+      line_to_current_position(z_probe_fast_mm_s);
+      planner.synchronize();
+    }
+    else
+  #endif
+      do_blocking_move_to_z(z, fr_mm_s);
 
   // Check to see if the probe was triggered
   const bool probe_triggered =
@@ -541,6 +573,13 @@ bool Probe::probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s) {
   // Tell the planner where we actually are
   sync_plan_position();
 
+  #if ENABLED(PROBE_FAST_MULTI)
+    // Count back from the top of the raise to the step where the probe triggered
+    trigger_z = current_position.z;
+    if (raise && probe_triggered)
+      trigger_z -= (stepper.position(Z_AXIS) - stepper.triggered_position(Z_AXIS)) * planner.mm_per_step[Z_AXIS];
+  #endif
+
   return !probe_triggered;
 }
 
@@ -589,16 +628,24 @@ bool Probe::probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s) {
  *
  * @return The Z position of the bed at the current XY or NAN on error.
  */
-float Probe::run_z_probe(const bool sanity_check/*=true*/) {
+#if ENABLED(PROBE_FAST_MULTI)
+  float Probe::run_z_probe(const bool sanity_check/*=true*/, const_float_t raise_after/*=0*/) {
+#else
+  float Probe::run_z_probe(const bool sanity_check/*=true*/) {
+#endif
   DEBUG_SECTION(log_probe, "Probe::run_z_probe", DEBUGGING(LEVELING));
 
-  auto try_to_probe = [&](PGM_P const plbl, const_float_t z_probe_low_point, const feedRate_t fr_mm_s, const bool scheck, const float clearance) -> bool {
+  auto try_to_probe = [&](PGM_P const plbl, const_float_t z_probe_low_point, const feedRate_t fr_mm_s, const bool scheck, const float clearance
+    OPTARG(PROBE_FAST_MULTI, const_float_t raise)
+  ) -> bool {
     // Tare the probe, if supported
     if (TERN0(PROBE_TARE, tare())) return true;
 
     // Do a first probe at the fast speed
-    const bool probe_fail = probe_down_to_z(z_probe_low_point, fr_mm_s),            // No probe trigger?
-               early_fail = (scheck && current_position.z > -offset.z + clearance); // Probe triggered too high?
+    const bool probe_fail = probe_down_to_z(z_probe_low_point, fr_mm_s OPTARG(PROBE_FAST_MULTI, raise)); // No probe trigger?
+    // With PROBE_FAST_MULTI the nozzle has already raised, so use the trigger height
+    const float probed_z = TERN(PROBE_FAST_MULTI, trigger_z, current_position.z);
+    const bool early_fail = (scheck && probed_z > -offset.z + clearance);                               // Probe triggered too high?
     #if ENABLED(DEBUG_LEVELING_FEATURE)
       if (DEBUGGING(LEVELING) && (probe_fail || early_fail)) {
         DEBUG_ECHOPGM_P(plbl);
@@ -620,19 +667,34 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
   // Double-probing does a fast probe followed by a slow probe
   #if TOTAL_PROBING == 2
 
+    #if ENABLED(PROBE_FAST_MULTI)
+      // With a steady fast/slow difference the fast probe alone will do, until the next check
+      const bool fast_only = fast_pairs >= PROBE_FAST_TRUST && fast_only_count < PROBE_FAST_RECHECK;
+    #endif
+
     // Attempt to tare the probe
     if (TERN0(PROBE_TARE, tare())) return NAN;
 
     // Do a first probe at the fast speed
     if (try_to_probe(PSTR("FAST"), z_probe_low_point, z_probe_fast_mm_s,
-                     sanity_check, Z_CLEARANCE_BETWEEN_PROBES) ) return NAN;
+                     sanity_check, Z_CLEARANCE_BETWEEN_PROBES
+                     OPTARG(PROBE_FAST_MULTI, fast_only ? raise_after : float(Z_CLEARANCE_MULTI_PROBE))) ) return NAN;
 
-    const float first_probe_z = current_position.z;
+    const float first_probe_z = TERN(PROBE_FAST_MULTI, trigger_z, current_position.z);
 
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("1st Probe Z:", first_probe_z);
 
-    // Raise to give the probe clearance
-    do_blocking_move_to_z(current_position.z + Z_CLEARANCE_MULTI_PROBE, z_probe_fast_mm_s);
+    #if ENABLED(PROBE_FAST_MULTI)
+      if (fast_only) {
+        fast_only_count++;
+        const float z2 = first_probe_z - fast_diff_sum / fast_pairs;
+        if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Slow probe skipped. 2nd Probe Z:", z2);
+        return (z2 * 3.0 + first_probe_z * 2.0) * 0.2;
+      }
+    #else
+      // Raise to give the probe clearance
+      do_blocking_move_to_z(current_position.z + Z_CLEARANCE_MULTI_PROBE, z_probe_fast_mm_s);
+    #endif
 
   #elif Z_PROBE_FEEDRATE_FAST != Z_PROBE_FEEDRATE_SLOW
 
@@ -666,11 +728,11 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
 
       // Probe downward slowly to find the bed
       if (try_to_probe(PSTR("SLOW"), z_probe_low_point, MMM_TO_MMS(Z_PROBE_FEEDRATE_SLOW),
-                       sanity_check, Z_CLEARANCE_MULTI_PROBE) ) return NAN;
+                       sanity_check, Z_CLEARANCE_MULTI_PROBE OPTARG(PROBE_FAST_MULTI, raise_after)) ) return NAN;
 
       TERN_(MEASURE_BACKLASH_WHEN_PROBING, backlash.measure_with_probe());
 
-      const float z = current_position.z;
+      const float z = TERN(PROBE_FAST_MULTI, trigger_z, current_position.z);
 
       #if EXTRA_PROBING > 0
         // Insert Z measurement into probes[]. Keep it sorted ascending.
@@ -721,10 +783,26 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
 
   #elif TOTAL_PROBING == 2
 
-    const float z2 = current_position.z;
+    const float z2 = TERN(PROBE_FAST_MULTI, trigger_z, current_position.z);
 
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("2nd Probe Z:", z2, " Discrepancy:", first_probe_z - z2);
 
+    #if ENABLED(PROBE_FAST_MULTI)
+      // Add the difference to the steady run, or start a new run with it
+      const float diff = first_probe_z - z2;
+      if (WITHIN(fast_pairs, 1, 254) && _MAX(fast_diff_max, diff) - _MIN(fast_diff_min, diff) <= PROBE_FAST_TOLERANCE) {
+        NOMORE(fast_diff_min, diff);
+        NOLESS(fast_diff_max, diff);
+        fast_diff_sum += diff;
+        fast_pairs++;
+      }
+      else {
+        fast_diff_min = fast_diff_max = fast_diff_sum = diff;
+        fast_pairs = 1;
+      }
+      fast_only_count = 0;
+    #endif
+
     // Return a weighted average of the fast and slow probes
     const float measured_z = (z2 * 3.0 + first_probe_z * 2.0) * 0.2;
 
@@ -778,11 +856,19 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
   // Move the probe to the starting XYZ
   do_blocking_move_to(npos, feedRate_t(XY_PROBE_FEEDRATE_MM_S));
 
+  // The raise between points can be queued right behind the probing move
+  #if ENABLED(PROBE_FAST_MULTI)
+    constexpr bool queued_raise = true;
+    const float early_raise = raise_after == PROBE_PT_RAISE ? Z_CLEARANCE_BETWEEN_PROBES : 0;
+  #else
+    constexpr bool queued_raise = false;
+  #endif
+
   float measured_z = NAN;
-  if (!deploy()) measured_z = run_z_probe(sanity_check) + offset.z;
+  if (!deploy()) measured_z = run_z_probe(sanity_check OPTARG(PROBE_FAST_MULTI, early_raise)) + offset.z;
   if (!isnan(measured_z)) {
     const bool big_raise = raise_after == PROBE_PT_BIG_RAISE;
-    if (big_raise || raise_after == PROBE_PT_RAISE)
+    if (big_raise || (raise_after == PROBE_PT_RAISE && !queued_raise))
       do_blocking_move_to_z(current_position.z + (big_raise ? 25 : Z_CLEARANCE_BETWEEN_PROBES), z_probe_fast_mm_s);
     else if (raise_after == PROBE_PT_STOW || raise_after == PROBE_PT_LAST_STOW)
       if (stow()) measured_z = NAN;   // Error on stow?
@@ -270,9 +270,17 @@ public:
   #endif
 
 private:
-  static bool probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s);
+  #if ENABLED(PROBE_FAST_MULTI)
+    static float trigger_z;
+    static uint8_t fast_pairs, fast_only_count;
+    static float fast_diff_min, fast_diff_max, fast_diff_sum;
+    static bool probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s, const_float_t raise=0);
+    static float run_z_probe(const bool sanity_check=true, const_float_t raise_after=0);
+  #else
+    static bool probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s);
+    static float run_z_probe(const bool sanity_check=true);
+  #endif
   static void do_z_raise(const float z_raise);
-  static float run_z_probe(const bool sanity_check=true);
 };
 
 extern Probe probe;
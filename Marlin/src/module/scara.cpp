@@ -294,6 +294,63 @@ float segments_per_second = TERN(AXEL_TPARA, TPARA_SEGMENTS_PER_SECOND, SCARA_SE
 
 #endif
 
+#ifdef KINEMATIC_SEGMENT_TOLERANCE
+
+  /**
+   * The arm joints move linearly from one segment end to the next, so at the
+   * middle of a segment of length h each joint is off by h^2/8 times its second
+   * derivative along the line. The effector moves by the inverse Jacobian of that,
+   * and only the part across the line bends the path.
+   *
+   * The derivatives come from the IK 1mm either side of 'raw' and 1mm off the line
+   * in two directions, which serves every SCARA and TPARA variant.
+   */
+  float segment_bow(const xyz_pos_t &raw, const xyz_float_t &dir) {
+    // Two unit vectors across the line
+    const float dir_xy = HYPOT(dir.x, dir.y);
+    if (UNEAR_ZERO(dir_xy)) return 0;
+    const xyz_float_t n = { -dir.y / dir_xy, dir.x / dir_xy, 0 },
+                      m = { -dir.z * n.y, dir.z * n.x, dir.x * n.y - dir.y * n.x };
+
+    const abce_pos_t saved = delta;
+    auto joints = [](const xyz_pos_t &p) {
+      inverse_kinematics(p);
+      return abc_float_t({ delta.a, delta.b, delta.c });
+    };
+    const abc_float_t q0 = joints(raw),
+                      qp = joints(raw + dir),
+                      qm = joints(raw - dir),
+                      qn = joints(raw + n),
+                      qz = joints(raw + m);
+    delta = saved;
+
+    // Joint angle differences, not upset by a wrap at +/-180
+    auto diff = [](const abc_float_t &a, const abc_float_t &b) {
+      abc_float_t d = a - b;
+      LOOP_ABC(i) { if (d[i] > 180) d[i] -= 360; else if (d[i] < -180) d[i] += 360; }
+      return d;
+    };
+    const abc_float_t ddq = diff(qp, q0) - diff(q0, qm),
+                      jd = diff(qp, qm) * 0.5f,
+                      jn = diff(qn, q0),
+                      jm = diff(qz, q0);
+
+    // Solve [jd jn jm] (a, b, c) = ddq. Only b and c are across the line.
+    const float det = jd.a * (jn.b * jm.c - jn.c * jm.b)
+                    - jn.a * (jd.b * jm.c - jd.c * jm.b)
+                    + jm.a * (jd.b * jn.c - jd.c * jn.b);
+    if (UNEAR_ZERO(det)) return 1e6f;  // Fully stretched or folded. Use the shortest segments.
+    const float b = jd.a * (ddq.b * jm.c - ddq.c * jm.b)
+                  - ddq.a * (jd.b * jm.c - jd.c * jm.b)
+                  + jm.a * (jd.b * ddq.c - jd.c * ddq.b),
+                c = jd.a * (jn.b * ddq.c - jn.c * ddq.b)
+                  - jn.a * (jd.b * ddq.c - jd.c * ddq.b)
+                  + ddq.a * (jd.b * jn.c - jd.c * jn.b);
+    return 0.125f * HYPOT(b, c) / ABS(det);
+  }
+
+#endif
+
 void scara_report_positions() {
   SERIAL_ECHOLNPGM("SCARA Theta:", planner.get_axis_position_degrees(A_AXIS)
     #if ENABLED(AXEL_TPARA)
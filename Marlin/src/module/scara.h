@@ -50,4 +50,13 @@ extern float segments_per_second;
 
 void inverse_kinematics(const xyz_pos_t &raw);
 void scara_set_axis_is_at_home(const AxisEnum axis);
+
+#ifdef KINEMATIC_SEGMENT_TOLERANCE
+  /**
+   * How far a segment through 'raw' along the unit vector 'dir' bows away
+   * from the straight line, in mm per mm^2 of segment length.
+   */
+  float segment_bow(const xyz_pos_t &raw, const xyz_float_t &dir);
+#endif
+
 void scara_report_positions();
@@ -337,6 +337,13 @@ typedef struct SettingsDataStruct {
   //
   PID_t chamberPID;                                     // M309 PID / M303 E-2 U
 
+  //
+  // MPCTEMP
+  //
+  #if ENABLED(MPCTEMP)
+    MPC_t mpc_constants[HOTENDS];                       // M306 / M306 T
+  #endif
+
   //
   // User-defined Thermistors
   //
@@ -989,6 +996,14 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(chamber_pid);
     }
 
+    //
+    // MPCTEMP
+    //
+    #if ENABLED(MPCTEMP)
+      _FIELD_TEST(mpc_constants);
+      HOTEND_LOOP() EEPROM_WRITE(thermalManager.temp_hotend[e].constants);
+    #endif
+
     //
     // User-defined Thermistors
     //
@@ -1856,6 +1871,20 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      //
+      // Hotend MPC constants
+      //
+      #if ENABLED(MPCTEMP)
+      {
+        _FIELD_TEST(mpc_constants);
+        HOTEND_LOOP() {
+          MPC_t mpc;
+          EEPROM_READ(mpc);
+          if (!validating) thermalManager.temp_hotend[e].constants = mpc;
+        }
+      }
+      #endif
+
       //
       // User-defined Thermistors
       //
@@ -2900,6 +2929,34 @@ void MarlinSettings::reset() {
     thermalManager.temp_chamber.pid.Kd = scalePID_d(DEFAULT_chamberKd);
   #endif
 
+  //
+  // Hotend MPC
+  //
+
+  #if ENABLED(MPCTEMP)
+    constexpr float heater_power[] = MPC_HEATER_POWER,
+                    block_heat_capacity[] = MPC_BLOCK_HEAT_CAPACITY,
+                    sensor_responsiveness[] = MPC_SENSOR_RESPONSIVENESS,
+                    ambient_xfer_coeff_fan0[] = MPC_AMBIENT_XFER_COEFF,
+                    ambient_xfer_coeff_fan255[] = MPC_AMBIENT_XFER_COEFF_FAN255,
+                    filament_heat_capacity_permm[] = FILAMENT_HEAT_CAPACITY_PERMM;
+    static_assert(WITHIN(COUNT(heater_power), 1, HOTENDS), "MPC_HEATER_POWER must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(block_heat_capacity), 1, HOTENDS), "MPC_BLOCK_HEAT_CAPACITY must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(sensor_responsiveness), 1, HOTENDS), "MPC_SENSOR_RESPONSIVENESS must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(ambient_xfer_coeff_fan0), 1, HOTENDS), "MPC_AMBIENT_XFER_COEFF must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(ambient_xfer_coeff_fan255), 1, HOTENDS), "MPC_AMBIENT_XFER_COEFF_FAN255 must have between 1 and HOTENDS items.");
+    static_assert(WITHIN(COUNT(filament_heat_capacity_permm), 1, HOTENDS), "FILAMENT_HEAT_CAPACITY_PERMM must have between 1 and HOTENDS items.");
+    HOTEND_LOOP() {
+      MPC_t &constants = thermalManager.temp_hotend[e].constants;
+      constants.heater_power                 = heater_power[ALIM(e, heater_power)];
+      constants.block_heat_capacity          = block_heat_capacity[ALIM(e, block_heat_capacity)];
+      constants.sensor_responsiveness        = sensor_responsiveness[ALIM(e, sensor_responsiveness)];
+      constants.ambient_xfer_coeff_fan0      = ambient_xfer_coeff_fan0[ALIM(e, ambient_xfer_coeff_fan0)];
+      constants.ambient_xfer_coeff_fan255    = ambient_xfer_coeff_fan255[ALIM(e, ambient_xfer_coeff_fan255)];
+      constants.filament_heat_capacity_permm = filament_heat_capacity_permm[ALIM(e, filament_heat_capacity_permm)];
+    }
+  #endif
+
   //
   // User-Defined Thermistors
   //
@@ -3191,6 +3248,7 @@ void MarlinSettings::reset() {
     TERN_(PIDTEMP,        gcode.M301_report(forReplay));
     TERN_(PIDTEMPBED,     gcode.M304_report(forReplay));
     TERN_(PIDTEMPCHAMBER, gcode.M309_report(forReplay));
+    TERN_(MPCTEMP,        gcode.M306_report(forReplay));
 
     #if HAS_USER_THERMISTORS
       LOOP_L_N(i, USER_THERMISTORS)
@@ -139,6 +139,14 @@ Stepper stepper; // Singleton
   #include "../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(EVENT_TRACE)
+  #include "../feature/event_trace.h"
+#endif
+
+#if ENABLED(PLANNER_STARVATION_MONITOR)
+  #include "../feature/planner_monitor.h"
+#endif
+
 // public:
 
 #if EITHER(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
@@ -224,13 +232,9 @@ uint32_t Stepper::advance_divisor = 0,
 
 #if ENABLED(LIN_ADVANCE)
 
-  uint32_t Stepper::nextAdvanceISR = LA_ADV_NEVER,
-           Stepper::LA_isr_rate = LA_ADV_NEVER;
-  uint16_t Stepper::LA_current_adv_steps = 0,
-           Stepper::LA_final_adv_steps,
-           Stepper::LA_max_adv_steps;
-
-  int8_t   Stepper::LA_steps = 0;
+  uint32_t Stepper::LA_advance_factor;
+  uint16_t Stepper::LA_current_adv_steps = 0;
+  int16_t  Stepper::LA_steps = 0;
 
   bool Stepper::LA_use_advance_lead;
 
@@ -594,29 +598,27 @@ void Stepper::set_directions() {
   TERN_(HAS_J_DIR, SET_STEP_DIR(J));
   TERN_(HAS_K_DIR, SET_STEP_DIR(K));
 
-  #if DISABLED(LIN_ADVANCE)
-    #if ENABLED(MIXING_EXTRUDER)
-       // Because this is valid for the whole block we don't know
-       // what e-steppers will step. Likely all. Set all.
-      if (motor_direction(E_AXIS)) {
-        MIXER_STEPPER_LOOP(j) REV_E_DIR(j);
-        count_direction.e = -1;
-      }
-      else {
-        MIXER_STEPPER_LOOP(j) NORM_E_DIR(j);
-        count_direction.e = 1;
-      }
-    #elif HAS_EXTRUDERS
-      if (motor_direction(E_AXIS)) {
-        REV_E_DIR(stepper_extruder);
-        count_direction.e = -1;
-      }
-      else {
-        NORM_E_DIR(stepper_extruder);
-        count_direction.e = 1;
-      }
-    #endif
-  #endif // !LIN_ADVANCE
+  #if ENABLED(MIXING_EXTRUDER)
+     // Because this is valid for the whole block we don't know
+     // what e-steppers will step. Likely all. Set all.
+    if (motor_direction(E_AXIS)) {
+      MIXER_STEPPER_LOOP(j) REV_E_DIR(j);
+      count_direction.e = -1;
+    }
+    else {
+      MIXER_STEPPER_LOOP(j) NORM_E_DIR(j);
+      count_direction.e = 1;
+    }
+  #elif HAS_EXTRUDERS
+    if (motor_direction(E_AXIS)) {
+      REV_E_DIR(stepper_extruder);
+      count_direction.e = -1;
+    }
+    else {
+      NORM_E_DIR(stepper_extruder);
+      count_direction.e = 1;
+    }
+  #endif
 
   #if HAS_L64XX
     if (L64XX_OK_to_power_up) { // OK to send the direction commands (which powers up the L64XX steppers)
@@ -1475,6 +1477,7 @@ void Stepper::isr() {
     // Disable interrupts, to avoid ISR preemption while we reprogram the period
     // (AVR enters the ISR with global interrupts disabled, so no need to do it here)
     DISABLE_ISRS();
+    TERN_(CRITICAL_SECTION_TRACE, TRACE_ISRS_OFF());
   #endif
 
   // Program timer compare for the maximum period, so it does NOT
@@ -1492,14 +1495,11 @@ void Stepper::isr() {
   hal_timer_t min_ticks;
   do {
     // Enable ISRs to reduce USART processing latency
+    TERN_(CRITICAL_SECTION_TRACE, TRACE_ISRS_ON());
     ENABLE_ISRS();
 
     if (!nextMainISR) pulse_phase_isr();                            // 0 = Do coordinated axes Stepper pulses
 
-    #if ENABLED(LIN_ADVANCE)
-      if (!nextAdvanceISR) nextAdvanceISR = advance_isr();          // 0 = Do Linear Advance E Stepper pulses
-    #endif
-
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       const bool is_babystep = (nextBabystepISR == 0);              // 0 = Do Babystepping (XY)Z pulses
       if (is_babystep) nextBabystepISR = babystepping_isr();
@@ -1521,7 +1521,6 @@ void Stepper::isr() {
     const uint32_t interval = _MIN(
       uint32_t(HAL_TIMER_TYPE_MAX),                     // Come back in a very long time
       nextMainISR                                       // Time until the next Pulse / Block phase
-      OPTARG(LIN_ADVANCE, nextAdvanceISR)               // Come back early for Linear Advance?
       OPTARG(INTEGRATED_BABYSTEPPING, nextBabystepISR)  // Come back early for Babystepping?
     );
 
@@ -1534,10 +1533,6 @@ void Stepper::isr() {
 
     nextMainISR -= interval;
 
-    #if ENABLED(LIN_ADVANCE)
-      if (nextAdvanceISR != LA_ADV_NEVER) nextAdvanceISR -= interval;
-    #endif
-
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       if (nextBabystepISR != BABYSTEP_NEVER) nextBabystepISR -= interval;
     #endif
@@ -1577,6 +1572,7 @@ void Stepper::isr() {
      * read and the write of the new period value).
      */
     DISABLE_ISRS();
+    TERN_(CRITICAL_SECTION_TRACE, TRACE_ISRS_OFF());
 
     /**
      * Get the current tick value + margin
@@ -1611,6 +1607,7 @@ void Stepper::isr() {
   HAL_timer_set_compare(STEP_TIMER_NUM, hal_timer_t(next_isr_ticks));
 
   // Don't forget to finally reenable interrupts
+  TERN_(CRITICAL_SECTION_TRACE, TRACE_ISRS_ON());
   ENABLE_ISRS();
 }
 
@@ -1621,6 +1618,49 @@ void Stepper::isr() {
   #define ISR_MULTI_STEPS 1
 #endif
 
+#if ENABLED(LIN_ADVANCE)
+
+  /**
+   * The pressure advance follows the step rate, so the target is recomputed
+   * whenever block_phase_isr changes speed. The difference is added to the
+   * pending E steps, which are made alongside the regular steps. Pressure is
+   * carried over from block to block, so it's only released where the speed
+   * or the extrusion ratio actually changes.
+   */
+  void Stepper::update_advance(const uint32_t step_rate) {
+    const uint16_t target_adv_steps = LA_use_advance_lead ? STEP_MULTIPLY(step_rate, LA_advance_factor) : 0;
+    LA_steps += int16_t(target_adv_steps - LA_current_adv_steps);
+    LA_current_adv_steps = target_adv_steps;
+  }
+
+  /**
+   * Take one pending E step, if any, turning the extruder around first
+   * when the pending steps go the other way. Return true to pulse E.
+   */
+  FORCE_INLINE bool Stepper::advance_step_needed() {
+    if (!LA_steps) return false;
+
+    const bool forward = LA_steps > 0;
+    if (forward != (count_direction.e > 0)) {
+      DIR_WAIT_BEFORE();
+      #if ENABLED(MIXING_EXTRUDER)
+        if (forward) { MIXER_STEPPER_LOOP(j) NORM_E_DIR(j); }
+        else         { MIXER_STEPPER_LOOP(j) REV_E_DIR(j); }
+      #else
+        if (forward) NORM_E_DIR(stepper_extruder); else REV_E_DIR(stepper_extruder);
+      #endif
+      count_direction.e = forward ? 1 : -1;
+      SET_BIT_TO(last_direction_bits, E_AXIS, !forward); // So set_directions knows the pin state
+      DIR_WAIT_AFTER();
+    }
+
+    count_position.e += count_direction.e;
+    LA_steps -= count_direction.e;
+    return true;
+  }
+
+#endif // LIN_ADVANCE
+
 /**
  * This phase of the ISR should ONLY create the pulses for the steppers.
  * This prevents jitter caused by the interval between the start of the
@@ -1637,7 +1677,23 @@ void Stepper::pulse_phase_isr() {
   }
 
   // If there is no current block, do nothing
-  if (!current_block) return;
+  if (!current_block) {
+    #if ENABLED(LIN_ADVANCE)
+      // Let the extruder finish the pressure change left over from the last block
+      if (advance_step_needed()) {
+        #if ISR_MULTI_STEPS
+          USING_TIMED_PULSE();
+          START_HIGH_PULSE();
+        #endif
+        E_STEP_WRITE(TERN(MIXING_EXTRUDER, mixer.get_next_stepper(), stepper_extruder), !INVERT_E_STEP_PIN);
+        #if ISR_MULTI_STEPS
+          AWAIT_HIGH_PULSE();
+        #endif
+        E_STEP_WRITE(TERN(MIXING_EXTRUDER, mixer.get_stepper(), stepper_extruder), INVERT_E_STEP_PIN);
+      }
+    #endif
+    return;
+  }
 
   // Skipping step processing causes motion to freeze
   if (TERN0(HAS_FREEZE_PIN, frozen)) return;
@@ -1814,17 +1870,19 @@ void Stepper::pulse_phase_isr() {
         PULSE_PREP(K);
       #endif
 
-      #if EITHER(LIN_ADVANCE, MIXING_EXTRUDER)
+      #if ENABLED(LIN_ADVANCE)
         delta_error.e += advance_dividend.e;
         if (delta_error.e >= 0) {
-          #if ENABLED(LIN_ADVANCE)
-            delta_error.e -= advance_divisor;
-            // Don't step E here - But remember the number of steps to perform
-            motor_direction(E_AXIS) ? --LA_steps : ++LA_steps;
-          #else
-            count_position.e += count_direction.e;
-            step_needed.e = true;
-          #endif
+          delta_error.e -= advance_divisor;
+          // Queue the nominal E step together with any pending advance steps
+          TEST(current_block->direction_bits, E_AXIS) ? --LA_steps : ++LA_steps;
+        }
+        step_needed.e = advance_step_needed();
+      #elif ENABLED(MIXING_EXTRUDER)
+        delta_error.e += advance_dividend.e;
+        if (delta_error.e >= 0) {
+          count_position.e += count_direction.e;
+          step_needed.e = true;
         }
       #elif HAS_E0_STEP
         PULSE_PREP(E);
@@ -1858,12 +1916,10 @@ void Stepper::pulse_phase_isr() {
       PULSE_START(K);
     #endif
 
-    #if DISABLED(LIN_ADVANCE)
-      #if ENABLED(MIXING_EXTRUDER)
-        if (step_needed.e) E_STEP_WRITE(mixer.get_next_stepper(), !INVERT_E_STEP_PIN);
-      #elif HAS_E0_STEP
-        PULSE_START(E);
-      #endif
+    #if ENABLED(MIXING_EXTRUDER)
+      if (step_needed.e) E_STEP_WRITE(mixer.get_next_stepper(), !INVERT_E_STEP_PIN);
+    #elif HAS_E0_STEP
+      PULSE_START(E);
     #endif
 
     #if ENABLED(I2S_STEPPER_STREAM)
@@ -1896,15 +1952,17 @@ void Stepper::pulse_phase_isr() {
       PULSE_STOP(K);
     #endif
 
-    #if DISABLED(LIN_ADVANCE)
-      #if ENABLED(MIXING_EXTRUDER)
+    #if ENABLED(MIXING_EXTRUDER)
+      #if ENABLED(LIN_ADVANCE)
+        if (step_needed.e) E_STEP_WRITE(mixer.get_stepper(), INVERT_E_STEP_PIN);
+      #else
         if (delta_error.e >= 0) {
           delta_error.e -= advance_divisor;
           E_STEP_WRITE(mixer.get_stepper(), INVERT_E_STEP_PIN);
         }
-      #elif HAS_E0_STEP
-        PULSE_STOP(E);
       #endif
+    #elif HAS_E0_STEP
+      PULSE_STOP(E);
     #endif
 
     #if ISR_MULTI_STEPS
@@ -1946,6 +2004,7 @@ uint32_t Stepper::block_phase_isr() {
         }
       #endif
       TERN_(HAS_FILAMENT_RUNOUT_DISTANCE, runout.block_completed(current_block));
+      TERN_(EVENT_TRACE, event_trace.record(EV_BLOCK_DONE, planner.block_buffer_tail, planner.movesplanned()));
       discard_current_block();
     }
     else {
@@ -1970,13 +2029,7 @@ uint32_t Stepper::block_phase_isr() {
         interval = calc_timer_interval(acc_step_rate, &steps_per_isr);
         acceleration_time += interval;
 
-        #if ENABLED(LIN_ADVANCE)
-          if (LA_use_advance_lead) {
-            // Fire ISR if final adv_rate is reached
-            if (LA_steps && LA_isr_rate != current_block->advance_speed) nextAdvanceISR = 0;
-          }
-          else if (LA_steps) nextAdvanceISR = 0;
-        #endif
+        TERN_(LIN_ADVANCE, update_advance(acc_step_rate));
 
         // Update laser - Accelerating
         #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
@@ -2044,16 +2097,7 @@ uint32_t Stepper::block_phase_isr() {
         interval = calc_timer_interval(step_rate, &steps_per_isr);
         deceleration_time += interval;
 
-        #if ENABLED(LIN_ADVANCE)
-          if (LA_use_advance_lead) {
-            // Wake up eISR on first deceleration loop and fire ISR if final adv_rate is reached
-            if (step_events_completed <= decelerate_after + steps_per_isr || (LA_steps && LA_isr_rate != current_block->advance_speed)) {
-              initiateLA();
-              LA_isr_rate = current_block->advance_speed;
-            }
-          }
-          else if (LA_steps) nextAdvanceISR = 0;
-        #endif // LIN_ADVANCE
+        TERN_(LIN_ADVANCE, update_advance(step_rate));
 
         // Update laser - Decelerating
         #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
@@ -2087,15 +2131,11 @@ uint32_t Stepper::block_phase_isr() {
       // Must be in cruise phase otherwise
       else {
 
-        #if ENABLED(LIN_ADVANCE)
-          // If there are any esteps, fire the next advance_isr "now"
-          if (LA_steps && LA_isr_rate != current_block->advance_speed) initiateLA();
-        #endif
-
         // Calculate the ticks_nominal for this nominal speed, if not done yet
         if (ticks_nominal < 0) {
           // step_rate to timer interval and loops for the nominal speed
           ticks_nominal = calc_timer_interval(current_block->nominal_rate, &steps_per_isr);
+          TERN_(LIN_ADVANCE, update_advance(current_block->nominal_rate));
         }
 
         // The timer interval is just the nominal value for the nominal speed
@@ -2153,6 +2193,9 @@ uint32_t Stepper::block_phase_isr() {
 
       TERN_(POWER_LOSS_RECOVERY, recovery.info.sdpos = current_block->sdpos);
 
+      TERN_(EVENT_TRACE, event_trace.record(EV_BLOCK_START, planner.block_buffer_tail, planner.movesplanned()));
+      TERN_(PLANNER_STARVATION_MONITOR, planner_monitor.block_started(planner.movesplanned()));
+
       #if ENABLED(DIRECT_STEPPING)
         if (IS_PAGE(current_block)) {
           page_step_state.segment_steps = 0;
@@ -2294,13 +2337,8 @@ uint32_t Stepper::block_phase_isr() {
           if (stepper_extruder != last_moved_extruder) LA_current_adv_steps = 0;
         #endif
 
-        if ((LA_use_advance_lead = current_block->use_advance_lead)) {
-          LA_final_adv_steps = current_block->final_adv_steps;
-          LA_max_adv_steps = current_block->max_adv_steps;
-          initiateLA(); // Start the ISR
-          LA_isr_rate = current_block->advance_speed;
-        }
-        else LA_isr_rate = LA_ADV_NEVER;
+        LA_use_advance_lead = current_block->use_advance_lead;
+        LA_advance_factor = current_block->advance_factor;
       #endif
 
       if ( ENABLED(HAS_L64XX)       // Always set direction for L64xx (Also enables the chips)
@@ -2375,6 +2413,9 @@ uint32_t Stepper::block_phase_isr() {
 
       // Calculate the initial timer interval
       interval = calc_timer_interval(current_block->initial_rate, &steps_per_isr);
+
+      // Set the extruder pressure for the entry speed
+      TERN_(LIN_ADVANCE, update_advance(current_block->initial_rate));
     }
     #if ENABLED(LASER_POWER_INLINE_CONTINUOUS)
       else { // No new block found; so apply inline laser parameters
@@ -2397,112 +2438,6 @@ uint32_t Stepper::block_phase_isr() {
   return interval;
 }
 
-#if ENABLED(LIN_ADVANCE)
-
-  // Timer interrupt for E. LA_steps is set in the main routine
-  uint32_t Stepper::advance_isr() {
-    uint32_t interval;
-
-    if (LA_use_advance_lead) {
-      if (step_events_completed > decelerate_after && LA_current_adv_steps > LA_final_adv_steps) {
-        LA_steps--;
-        LA_current_adv_steps--;
-        interval = LA_isr_rate;
-      }
-      else if (step_events_completed < decelerate_after && LA_current_adv_steps < LA_max_adv_steps) {
-        LA_steps++;
-        LA_current_adv_steps++;
-        interval = LA_isr_rate;
-      }
-      else
-        interval = LA_isr_rate = LA_ADV_NEVER;
-    }
-    else
-      interval = LA_ADV_NEVER;
-
-    if (!LA_steps) return interval; // Leave pins alone if there are no steps!
-
-    DIR_WAIT_BEFORE();
-
-    #if ENABLED(MIXING_EXTRUDER)
-      // We don't know which steppers will be stepped because LA loop follows,
-      // with potentially multiple steps. Set all.
-      if (LA_steps > 0) {
-        MIXER_STEPPER_LOOP(j) NORM_E_DIR(j);
-        count_direction.e = 1;
-      }
-      else if (LA_steps < 0) {
-        MIXER_STEPPER_LOOP(j) REV_E_DIR(j);
-        count_direction.e = -1;
-      }
-    #else
-      if (LA_steps > 0) {
-        NORM_E_DIR(stepper_extruder);
-        count_direction.e = 1;
-      }
-      else if (LA_steps < 0) {
-        REV_E_DIR(stepper_extruder);
-        count_direction.e = -1;
-      }
-    #endif
-
-    DIR_WAIT_AFTER();
-
-    //const hal_timer_t added_step_ticks = hal_timer_t(ADDED_STEP_TICKS);
-
-    // Step E stepper if we have steps
-    #if ISR_MULTI_STEPS
-      bool firstStep = true;
-      USING_TIMED_PULSE();
-    #endif
-
-    while (LA_steps) {
-      #if ISR_MULTI_STEPS
-        if (firstStep)
-          firstStep = false;
-        else
-          AWAIT_LOW_PULSE();
-      #endif
-
-      count_position.e += count_direction.e;
-
-      // Set the STEP pulse ON
-      #if ENABLED(MIXING_EXTRUDER)
-        E_STEP_WRITE(mixer.get_next_stepper(), !INVERT_E_STEP_PIN);
-      #else
-        E_STEP_WRITE(stepper_extruder, !INVERT_E_STEP_PIN);
-      #endif
-
-      // Enforce a minimum duration for STEP pulse ON
-      #if ISR_PULSE_CONTROL
-        START_HIGH_PULSE();
-      #endif
-
-      LA_steps < 0 ? ++LA_steps : --LA_steps;
-
-      #if ISR_PULSE_CONTROL
-        AWAIT_HIGH_PULSE();
-      #endif
-
-      // Set the STEP pulse OFF
-      #if ENABLED(MIXING_EXTRUDER)
-        E_STEP_WRITE(mixer.get_stepper(), INVERT_E_STEP_PIN);
-      #else
-        E_STEP_WRITE(stepper_extruder, INVERT_E_STEP_PIN);
-      #endif
-
-      // For minimum pulse time wait before looping
-      // Just wait for the requested pulse duration
-      #if ISR_PULSE_CONTROL
-        if (LA_steps) START_LOW_PULSE();
-      #endif
-    } // LA_steps
-
-    return interval;
-  }
-
-#endif // LIN_ADVANCE
-
 #if ENABLED(INTEGRATED_BABYSTEPPING)
 
   // Timer interrupt for baby-stepping
@@ -48,6 +48,9 @@
 #ifdef __AVR__
   #include "speed_lookuptable.h"
 #endif
+#if ENABLED(CRITICAL_SECTION_TRACE)
+  #include "../feature/critical_trace.h"
+#endif
 
 // Disable multiple steps per ISR
 //#define DISABLE_MULTI_STEPPING
@@ -78,7 +81,7 @@
   // The base ISR takes 792 cycles
   #define ISR_BASE_CYCLES  792UL
 
-  // Linear advance base time is 64 cycles
+  // Linear advance adds 64 cycles to update the pressure
   #if ENABLED(LIN_ADVANCE)
     #define ISR_LA_BASE_CYCLES 64UL
   #else
@@ -108,7 +111,7 @@
   // The base ISR takes 752 cycles
   #define ISR_BASE_CYCLES  752UL
 
-  // Linear advance base time is 32 cycles
+  // Linear advance adds 32 cycles to update the pressure
   #if ENABLED(LIN_ADVANCE)
     #define ISR_LA_BASE_CYCLES 32UL
   #else
@@ -133,8 +136,8 @@
 
 #endif
 
-// If linear advance is disabled, the loop also handles them
-#if DISABLED(LIN_ADVANCE) && ENABLED(MIXING_EXTRUDER)
+// Mixing steppers are handled in the loop
+#if ENABLED(MIXING_EXTRUDER)
   #define ISR_MIXING_STEPPER_CYCLES ((MIXING_STEPPERS) * (ISR_STEPPER_CYCLES))
 #else
   #define ISR_MIXING_STEPPER_CYCLES  0UL
@@ -196,30 +199,8 @@
 // But the user could be enforcing a minimum time, so the loop time is
 #define ISR_LOOP_CYCLES (ISR_LOOP_BASE_CYCLES + _MAX(MIN_STEPPER_PULSE_CYCLES, MIN_ISR_LOOP_CYCLES))
 
-// If linear advance is enabled, then it is handled separately
-#if ENABLED(LIN_ADVANCE)
-
-  // Estimate the minimum LA loop time
-  #if ENABLED(MIXING_EXTRUDER) // ToDo: ???
-    // HELP ME: What is what?
-    // Directions are set up for MIXING_STEPPERS - like before.
-    // Finding the right stepper may last up to MIXING_STEPPERS loops in get_next_stepper().
-    //   These loops are a bit faster than advancing a bresenham counter.
-    // Always only one e-stepper is stepped.
-    #define MIN_ISR_LA_LOOP_CYCLES ((MIXING_STEPPERS) * (ISR_STEPPER_CYCLES))
-  #else
-    #define MIN_ISR_LA_LOOP_CYCLES ISR_STEPPER_CYCLES
-  #endif
-
-  // And the real loop time
-  #define ISR_LA_LOOP_CYCLES _MAX(MIN_STEPPER_PULSE_CYCLES, MIN_ISR_LA_LOOP_CYCLES)
-
-#else
-  #define ISR_LA_LOOP_CYCLES 0UL
-#endif
-
 // Now estimate the total ISR execution time in cycles given a step per ISR multiplier
-#define ISR_EXECUTION_CYCLES(R) (((ISR_BASE_CYCLES + ISR_S_CURVE_CYCLES + (ISR_LOOP_CYCLES) * (R) + ISR_LA_BASE_CYCLES + ISR_LA_LOOP_CYCLES)) / (R))
+#define ISR_EXECUTION_CYCLES(R) (((ISR_BASE_CYCLES + ISR_S_CURVE_CYCLES + (ISR_LOOP_CYCLES) * (R) + ISR_LA_BASE_CYCLES)) / (R))
 
 // The maximum allowable stepping frequency when doing x128-x1 stepping (in Hz)
 #define MAX_STEP_ISR_FREQUENCY_128X ((F_CPU) / ISR_EXECUTION_CYCLES(128))
@@ -400,10 +381,9 @@ class Stepper {
     #endif
 
     #if ENABLED(LIN_ADVANCE)
-      static constexpr uint32_t LA_ADV_NEVER = 0xFFFFFFFF;
-      static uint32_t nextAdvanceISR, LA_isr_rate;
-      static uint16_t LA_current_adv_steps, LA_final_adv_steps, LA_max_adv_steps; // Copy from current executed block. Needed because current_block is set to NULL "too early".
-      static int8_t LA_steps;
+      static uint32_t LA_advance_factor;      // Copy from current executed block. Needed because current_block is set to NULL "too early".
+      static uint16_t LA_current_adv_steps;   // Advance steps currently applied to the extruder
+      static int16_t LA_steps;                // E steps still to be made, nominal plus advance
       static bool LA_use_advance_lead;
     #endif
 
@@ -457,15 +437,30 @@ class Stepper {
 
     // The stepper subsystem goes to sleep when it runs out of things to execute.
     // Call this to notify the subsystem that it is time to go to work.
-    static inline void wake_up() { ENABLE_STEPPER_DRIVER_INTERRUPT(); }
+    static inline void wake_up() {
+      TERN_(CRITICAL_SECTION_TRACE, critical_trace.leave(TRACE_STEPPER));
+      ENABLE_STEPPER_DRIVER_INTERRUPT();
+    }
 
     static inline bool is_awake() { return STEPPER_ISR_ENABLED(); }
 
-    static inline bool suspend() {
-      const bool awake = is_awake();
-      if (awake) DISABLE_STEPPER_DRIVER_INTERRUPT();
-      return awake;
-    }
+    #if ENABLED(CRITICAL_SECTION_TRACE)
+      // Charge the time until wake_up() to the caller
+      static inline bool suspend(const char * const file=__builtin_FILE(), const uint16_t line=__builtin_LINE()) {
+        const bool awake = is_awake();
+        if (awake) {
+          DISABLE_STEPPER_DRIVER_INTERRUPT();
+          critical_trace.enter(TRACE_STEPPER, file, line);
+        }
+        return awake;
+      }
+    #else
+      static inline bool suspend() {
+        const bool awake = is_awake();
+        if (awake) DISABLE_STEPPER_DRIVER_INTERRUPT();
+        return awake;
+      }
+    #endif
 
     // The ISR scheduler
     static void isr();
@@ -477,9 +472,10 @@ class Stepper {
     static uint32_t block_phase_isr();
 
     #if ENABLED(LIN_ADVANCE)
-      // The Linear advance ISR phase
-      static uint32_t advance_isr();
-      FORCE_INLINE static void initiateLA() { nextAdvanceISR = 0; }
+      // Set the extruder advance for the given step rate
+      static void update_advance(const uint32_t step_rate);
+      // Take the next pending extruder step
+      static bool advance_step_needed();
     #endif
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
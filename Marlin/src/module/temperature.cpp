@@ -133,7 +133,7 @@
   #endif
 #endif
 
-#if ENABLED(PID_EXTRUSION_SCALING)
+#if EITHER(PID_EXTRUSION_SCALING, MPCTEMP)
   #include "stepper.h"
 #endif
 
@@ -173,16 +173,29 @@
   #include "servo.h"
 #endif
 
+#if ENABLED(EVENT_TRACE)
+  #include "../feature/event_trace.h"
+#endif
+
+#if ENABLED(PLANNER_STARVATION_MONITOR)
+  #include "../feature/planner_monitor.h"
+#endif
+
 #if ANY(TEMP_SENSOR_0_IS_THERMISTOR, TEMP_SENSOR_1_IS_THERMISTOR, TEMP_SENSOR_2_IS_THERMISTOR, TEMP_SENSOR_3_IS_THERMISTOR, \
         TEMP_SENSOR_4_IS_THERMISTOR, TEMP_SENSOR_5_IS_THERMISTOR, TEMP_SENSOR_6_IS_THERMISTOR, TEMP_SENSOR_7_IS_THERMISTOR )
   #define HAS_HOTEND_THERMISTOR 1
 #endif
 
 #if HAS_HOTEND_THERMISTOR
-  #define NEXT_TEMPTABLE(N) ,TEMPTABLE_##N
-  #define NEXT_TEMPTABLE_LEN(N) ,TEMPTABLE_##N##_LEN
-  static const temp_entry_t* heater_ttbl_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0 REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE));
-  static constexpr uint8_t heater_ttbllen_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0_LEN REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE_LEN));
+  #if ENABLED(FAST_THERMISTOR_CONVERSION)
+    #define NEXT_TEMPTABLE_LOOKUP(N) ,TEMPTABLE_##N##_LOOKUP
+    static const thermistor_lookup_t* heater_lookup_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0_LOOKUP REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE_LOOKUP));
+  #else
+    #define NEXT_TEMPTABLE(N) ,TEMPTABLE_##N
+    #define NEXT_TEMPTABLE_LEN(N) ,TEMPTABLE_##N##_LEN
+    static const temp_entry_t* heater_ttbl_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0 REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE));
+    static constexpr uint8_t heater_ttbllen_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0_LEN REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE_LEN));
+  #endif
 #endif
 
 Temperature thermalManager;
@@ -826,6 +839,199 @@ volatile bool Temperature::raw_temps_ready = false;
 
 #endif // HAS_PID_HEATING
 
+#if ENABLED(MPCTEMP)
+
+  /**
+   * Identify the hotend model for MPCTEMP (M306 T)
+   *
+   *  - Let the hotend settle to find the ambient temperature.
+   *  - Heat at full power to the target. Three equally spaced points on the
+   *    rise give the asymptotic temperature and time constant, and from them
+   *    the ambient losses and block heat capacity. The delay of the fitted
+   *    curve gives the sensor responsiveness.
+   *  - Hold the target with the new model and measure the average power,
+   *    first with the part cooling fan off and then at full speed.
+   *
+   * Heater power and filament heat capacity are not identified. The
+   * other values are in proportion to the configured heater power.
+   */
+  void Temperature::MPC_autotune(const uint8_t e, const celsius_t target) {
+    #if HAS_FAN
+      // Apply the fan speed now, since the planner won't run while tuning
+      const uint8_t fan_index = _MIN(e, FAN_COUNT - 1);
+      auto set_tuning_fan = [&](const uint8_t speed) {
+        set_fan_speed(fan_index, speed);
+        planner.sync_fan_speeds(fan_speed);
+      };
+    #endif
+    hotend_info_t &hotend = temp_hotend[e];
+    MPC_t &constants = hotend.constants;
+
+    millis_t next_report_ms = 0;
+
+    // Wait for the next temperature sample, keeping the UI alive. False if aborted with M108.
+    auto next_sample = [&]() {
+      for (;;) {
+        if (!wait_for_heatup) return false;
+        if (updateTemperaturesIfReady()) break;
+        TERN_(HAL_IDLETASK, HAL_idletask());
+        TERN(HAS_DWIN_E3V2_BASIC, DWIN_Update(), ui.update());
+      }
+      const millis_t ms = millis();
+      if (ELAPSED(ms, next_report_ms)) {
+        next_report_ms = ms + 2000UL;
+        print_heater_states(e);
+        SERIAL_EOL();
+      }
+      return true;
+    };
+
+    // Hold the target with the model and return the average power (W) over a window.
+    // The temperature must stay within TEMP_HYSTERESIS of the target for the settle time first.
+    auto measure_power = [&](float &avg_temp) {
+      float power_sum = 0, temp_sum = 0;
+      uint16_t count = 0;
+      millis_t settle_ms = 0;
+      for (;;) {
+        if (!next_sample()) return NAN;
+        hotend.soft_pwm_amount = (int)get_pid_output_hotend(e) >> 1;
+        const millis_t ms = millis();
+        if (ABS(hotend.celsius - target) > TEMP_HYSTERESIS) {
+          settle_ms = 0;
+          power_sum = temp_sum = count = 0;
+        }
+        else if (!settle_ms)
+          settle_ms = ms + SEC_TO_MS(MPC_TUNING_SETTLE_TIME);
+        else if (ELAPSED(ms, settle_ms)) {
+          power_sum += hotend.soft_pwm_amount * constants.heater_power * (1.0f / 127);
+          temp_sum += hotend.celsius;
+          if (++count >= MPC_TUNING_SETTLE_TIME / MPC_dT) break;
+        }
+      }
+      avg_temp = temp_sum / count;
+      return power_sum / count;
+    };
+
+    SERIAL_ECHOLNPGM("MPC autotune start for E", e);
+
+    if (target > temp_range[e].maxtemp - (HOTEND_OVERSHOOT)) {
+      SERIAL_ECHOLNPGM(STR_PID_TEMP_TOO_HIGH);
+      return;
+    }
+
+    disable_all_heaters();
+    TERN_(AUTO_POWER_CONTROL, powerManager.power_on());
+
+    wait_for_heatup = true; // Can be interrupted with M108
+
+    // Cool with the fan until the temperature stops falling
+    TERN_(HAS_STATUS_MESSAGE, ui.status_printf_P(0, PSTR(S_FMT), "MPC cooling"));
+    SERIAL_ECHOLNPGM("Cooling to ambient");
+    TERN_(HAS_FAN, set_tuning_fan(255));
+    float ambient_temp = degHotend(e), heating_rate = 0;
+    for (millis_t check_ms = millis() + 10000UL;;) {
+      if (!next_sample()) goto MPC_ABORT;
+      if (ELAPSED(millis(), check_ms)) {
+        if (ambient_temp - degHotend(e) < 0.2f) break;
+        ambient_temp = degHotend(e);
+        check_ms = millis() + 10000UL;
+      }
+    }
+    ambient_temp = degHotend(e);
+    TERN_(HAS_FAN, set_tuning_fan(0));
+
+    {
+      // Heat at full power, logging samples. When the log is full every other
+      // sample is dropped and the interval doubles, so any rise time fits.
+      constexpr uint8_t sample_count = 32;
+      float samples[sample_count];
+      uint8_t n = 0;
+      millis_t interval_ms = 1000UL;
+
+      TERN_(HAS_STATUS_MESSAGE, ui.status_printf_P(0, PSTR(S_FMT), "MPC heating"));
+      SERIAL_ECHOLNPGM("Heating to ", target, "C");
+      hotend.soft_pwm_amount = (MPC_MAX) >> 1;
+      const millis_t start_ms = millis();
+      millis_t sample_ms = start_ms + interval_ms;
+      while (degHotend(e) < target) {
+        if (!next_sample()) goto MPC_ABORT;
+        if (ELAPSED(millis(), sample_ms)) {
+          if (n == sample_count) {
+            LOOP_L_N(i, sample_count / 2) samples[i] = samples[i * 2 + 1];
+            n = sample_count / 2;
+            interval_ms *= 2;
+          }
+          samples[n++] = degHotend(e);
+          sample_ms = start_ms + (n + 1) * interval_ms;
+        }
+      }
+      hotend.soft_pwm_amount = 0;
+
+      // Sample i was taken at (i + 1) * interval
+      const uint8_t k = (n - 1) / 3, i3 = n - 1, i2 = i3 - k, i1 = i2 - k;
+      const float t1 = samples[i1], t2 = samples[i2], t3 = samples[i3],
+                  denom = t1 + t3 - 2 * t2;
+      if (k < 2 || denom >= 0 || t2 <= t1) {
+        SERIAL_ECHOLNPGM("MPC autotune failed: heating curve does not level off");
+        goto MPC_ABORT;
+      }
+      const float asymp_temp = (t1 * t3 - sq(t2)) / denom,
+                  interval_s = interval_ms * 0.001f,
+                  tau = -(k * interval_s) / logf((t3 - t2) / (t2 - t1)),
+                  delay = (i1 + 1) * interval_s + tau * logf((asymp_temp - t1) / (asymp_temp - ambient_temp));
+
+      constants.ambient_xfer_coeff_fan0 = constants.heater_power / (asymp_temp - ambient_temp);
+      constants.block_heat_capacity = tau * constants.ambient_xfer_coeff_fan0;
+      // A first-order sensor delays the late part of the rise by -tau * ln(1 - 1 / (R * tau))
+      constants.sensor_responsiveness = delay > 0 ? 1.0f / (tau * (1.0f - expf(-delay / tau))) : 1.0f / MPC_dT;
+
+      heating_rate = (t3 - samples[i3 - 1]) / interval_s;
+    }
+
+    {
+      // Refine the ambient losses from the power needed to hold the target
+      TERN_(HAS_STATUS_MESSAGE, ui.status_printf_P(0, PSTR(S_FMT), "MPC measuring"));
+      SERIAL_ECHOLNPGM("Measuring ambient losses");
+      // The block leads the sensor by its rate of rise over the responsiveness
+      hotend.modeled_ambient_temp = ambient_temp;
+      hotend.modeled_sensor_temp = hotend.celsius;
+      hotend.modeled_block_temp = hotend.celsius + heating_rate / constants.sensor_responsiveness;
+      hotend.target = target;
+
+      float avg_temp;
+      const float power_fan0 = measure_power(avg_temp);
+      if (isnan(power_fan0)) goto MPC_ABORT;
+      constants.ambient_xfer_coeff_fan0 = power_fan0 / (avg_temp - ambient_temp);
+
+      #if HAS_FAN
+        set_tuning_fan(255);
+        const float power_fan255 = measure_power(avg_temp);
+        set_tuning_fan(0);
+        if (isnan(power_fan255)) goto MPC_ABORT;
+        constants.ambient_xfer_coeff_fan255 = power_fan255 / (avg_temp - ambient_temp);
+      #else
+        constants.ambient_xfer_coeff_fan255 = constants.ambient_xfer_coeff_fan0;
+      #endif
+    }
+
+    SERIAL_ECHOLNPGM("MPC autotune finished. Apply with M500 or put in Configuration.h:");
+    SERIAL_ECHOLNPGM("MPC_BLOCK_HEAT_CAPACITY ", constants.block_heat_capacity);
+    SERIAL_ECHOLNPAIR_F("MPC_SENSOR_RESPONSIVENESS ", constants.sensor_responsiveness, 4);
+    SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF ", constants.ambient_xfer_coeff_fan0, 4);
+    #if HAS_FAN
+      SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF_FAN255 ", constants.ambient_xfer_coeff_fan255, 4);
+    #endif
+
+    MPC_ABORT:
+    wait_for_heatup = false;
+    TERN_(HAS_FAN, set_tuning_fan(0));
+    hotend.target = 0;
+    hotend.soft_pwm_amount = 0;
+    hotend.modeled_block_temp = NAN;
+  }
+
+#endif // MPCTEMP
+
 int16_t Temperature::getHeaterPower(const heater_id_t heater_id) {
   switch (heater_id) {
     #if HAS_HEATED_BED
@@ -1139,6 +1345,61 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
         }
       #endif
 
+    #elif ENABLED(MPCTEMP)
+
+      MPCHeaterInfo &hotend = temp_hotend[ee];
+      const MPC_t &constants = hotend.constants;
+
+      // At startup, seed the model with the measured temperature
+      if (isnan(hotend.modeled_block_temp)) {
+        hotend.modeled_ambient_temp = _MIN(30.0f, hotend.celsius);  // Cap at a warm room temperature
+        hotend.modeled_block_temp = hotend.modeled_sensor_temp = hotend.celsius;
+      }
+
+      // Losses to ambient rise with the part cooling fan speed
+      float ambient_xfer_coeff = constants.ambient_xfer_coeff_fan0;
+      #if HAS_FAN
+        ambient_xfer_coeff += fan_speed[_MIN(ee, FAN_COUNT - 1)] * (constants.ambient_xfer_coeff_fan255 - constants.ambient_xfer_coeff_fan0) * (1.0f / 255);
+      #endif
+
+      // Filament losses, from the E steps taken since the last sample
+      float e_speed = 0;
+      #if HAS_EXTRUDERS
+        static int32_t mpc_last_e_position; // = 0
+        if (ee == active_extruder) {
+          const int32_t e_position = stepper.position(E_AXIS);
+          e_speed = (e_position - mpc_last_e_position) * planner.mm_per_step[E_AXIS_N(ee)] / MPC_dT;
+          mpc_last_e_position = e_position;
+          LIMIT(e_speed, 0, planner.settings.max_feedrate_mm_s[E_AXIS_N(ee)]); // Ignore retracts and G92 jumps
+        }
+      #endif
+      const float loss_coeff = ambient_xfer_coeff + e_speed * constants.filament_heat_capacity_permm;
+
+      // Advance the model by one sample with the power that was applied
+      const float last_power = hotend.soft_pwm_amount * constants.heater_power * (1.0f / 127);
+      hotend.modeled_block_temp += (last_power - loss_coeff * (hotend.modeled_block_temp - hotend.modeled_ambient_temp))
+                                   * MPC_dT / constants.block_heat_capacity;
+      hotend.modeled_sensor_temp += _MIN(constants.sensor_responsiveness * MPC_dT, 1.0f)
+                                    * (hotend.modeled_block_temp - hotend.modeled_sensor_temp);
+
+      // Pull the model toward the measurement. While regulating, the remaining
+      // error is put down to a change in ambient temperature.
+      const float delta_to_apply = (hotend.celsius - hotend.modeled_sensor_temp) * (MPC_SMOOTHING_FACTOR);
+      hotend.modeled_block_temp += delta_to_apply;
+      hotend.modeled_sensor_temp += delta_to_apply;
+      if (WITHIN(hotend.soft_pwm_amount, 1, 126)) {
+        const float max_change = (MPC_MAX_AMBIENT_CHANGE) * MPC_dT;
+        hotend.modeled_ambient_temp += constrain(delta_to_apply, -max_change, max_change);
+      }
+
+      // Power to bring the modeled block to the target in one sample and hold it there
+      float power = 0;
+      if (hotend.target && !TERN0(HEATER_IDLE_HANDLER, heater_idle[ee].timed_out))
+        power = (hotend.target - hotend.modeled_block_temp) * constants.block_heat_capacity / MPC_dT
+              + (hotend.target - hotend.modeled_ambient_temp) * loss_coeff;
+
+      const float pid_output = constrain(power, 0, constants.heater_power) * (MPC_MAX) / constants.heater_power;
+
     #else // No PID enabled
 
       const bool is_idling = TERN0(HEATER_IDLE_HANDLER, heater_idle[ee].timed_out);
@@ -1336,6 +1597,7 @@ void Temperature::manage_heater() {
       #endif
 
       temp_hotend[e].soft_pwm_amount = (temp_hotend[e].celsius > temp_range[e].mintemp || is_preheating(e)) && temp_hotend[e].celsius < temp_range[e].maxtemp ? (int)get_pid_output_hotend(e) >> 1 : 0;
+      TERN_(EVENT_TRACE, event_trace.record(EV_HEATER_PWM, H_E0 + e, temp_hotend[e].soft_pwm_amount));
 
       #if WATCH_HOTENDS
         // Make sure temperature is increasing
@@ -1447,6 +1709,8 @@ void Temperature::manage_heater() {
         #endif
       }
 
+      TERN_(EVENT_TRACE, event_trace.record(EV_HEATER_PWM, uint8_t(H_BED), temp_bed.soft_pwm_amount));
+
     } while (false);
 
   #endif // HAS_HEATED_BED
@@ -1652,27 +1916,11 @@ void Temperature::manage_heater() {
 #define TEMP_AD595(RAW)  ((RAW) * 5.0 * 100.0 / float(HAL_ADC_RANGE) / (OVERSAMPLENR) * (TEMP_SENSOR_AD595_GAIN) + TEMP_SENSOR_AD595_OFFSET)
 #define TEMP_AD8495(RAW) ((RAW) * 6.6 * 100.0 / float(HAL_ADC_RANGE) / (OVERSAMPLENR) * (TEMP_SENSOR_AD8495_GAIN) + TEMP_SENSOR_AD8495_OFFSET)
 
-/**
- * Bisect search for the range of the 'raw' value, then interpolate
- * proportionally between the under and over values.
- */
-#define SCAN_THERMISTOR_TABLE(TBL,LEN) do{                                \
-  uint8_t l = 0, r = LEN, m;                                              \
-  for (;;) {                                                              \
-    m = (l + r) >> 1;                                                     \
-    if (!m) return celsius_t(pgm_read_word(&TBL[0].celsius));             \
-    if (m == l || m == r) return celsius_t(pgm_read_word(&TBL[LEN-1].celsius)); \
-    int16_t v00 = pgm_read_word(&TBL[m-1].value),                         \
-            v10 = pgm_read_word(&TBL[m-0].value);                         \
-         if (raw < v00) r = m;                                            \
-    else if (raw > v10) l = m;                                            \
-    else {                                                                \
-      const celsius_t v01 = celsius_t(pgm_read_word(&TBL[m-1].celsius)),  \
-                      v11 = celsius_t(pgm_read_word(&TBL[m-0].celsius));  \
-      return v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00);     \
-    }                                                                     \
-  }                                                                       \
-}while(0)
+#if ENABLED(FAST_THERMISTOR_CONVERSION)
+  #undef SCAN_THERMISTOR_TABLE
+  #define SCAN_THERMISTOR_TABLE(TBL,LEN) LOOKUP_THERMISTOR_TABLE((thermistor_lookup<TBL, LEN>))
+
+#endif
 
 #if HAS_USER_THERMISTORS
 
@@ -1757,6 +2005,23 @@ void Temperature::manage_heater() {
     SERIAL_EOL();
   }
 
+  #if ENABLED(FAST_THERMISTOR_CONVERSION)
+    /**
+     * log2(x) in Q15 fixed point, for x > 0, good to about 1e-4.
+     * The exponent comes from the top bit, and log2(1 + m) of the
+     * remaining mantissa from a 4th order polynomial in Q15.
+     */
+    static int32_t log2_q15(const uint32_t x) {
+      const uint8_t e = 31 - __builtin_clz(x);
+      const int32_t m = ((x << (31 - e)) & 0x7FFFFFFFUL) >> 16;   // 0 <= m < 1
+      int32_t p = -2778;                                          // -0.084772
+      p = 10669 + ((p * m) >> 15);                                //  0.325601
+      p = -22281 + ((p * m) >> 15);                               // -0.679947
+      p = 47154 + ((p * m) >> 15);                                //  1.439015
+      return (int32_t(e) << 15) + ((p * m) >> 15);
+    }
+  #endif
+
   celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const int16_t raw) {
 
     if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
@@ -1775,9 +2040,21 @@ void Temperature::manage_heater() {
     const int adc_max = MAX_RAW_THERMISTOR_VALUE,
               adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
 
-    const float adc_inverse = (adc_max - adc_raw) - 0.5f,
-                resistance = t.series_res * (adc_raw + 0.5f) / adc_inverse,
-                log_resistance = logf(resistance);
+    #if ENABLED(FAST_THERMISTOR_CONVERSION)
+      // ln(series_res * (adc_raw + 0.5) / (adc_max - adc_raw - 0.5)) with the ADC part in integer math.
+      // The pull-up resistor's log is kept here, since M305 and EEPROM loads don't flag 'pre_calc' for it.
+      static float last_series_res[USER_THERMISTORS], series_res_log[USER_THERMISTORS];
+      if (last_series_res[t_index] != t.series_res) {
+        last_series_res[t_index] = t.series_res;
+        series_res_log[t_index] = logf(t.series_res);
+      }
+      const float log_resistance = series_res_log[t_index]
+        + (log2_q15(2 * adc_raw + 1) - log2_q15(2 * (adc_max - adc_raw) - 1)) * (0.6931472f / 32768);   // ln(2) / Q15
+    #else
+      const float adc_inverse = (adc_max - adc_raw) - 0.5f,
+                  resistance = t.series_res * (adc_raw + 0.5f) / adc_inverse,
+                  log_resistance = logf(resistance);
+    #endif
 
     float value = t.sh_alpha;
     value += log_resistance * t.beta_recip;
@@ -1906,8 +2183,12 @@ void Temperature::manage_heater() {
 
     #if HAS_HOTEND_THERMISTOR
       // Thermistor with conversion table?
-      const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
-      SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #if ENABLED(FAST_THERMISTOR_CONVERSION)
+        LOOKUP_THERMISTOR_TABLE((*heater_lookup_map[e]));
+      #else
+        const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
+        SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #endif
     #endif
 
     return 0;
@@ -2152,6 +2433,10 @@ void Temperature::init() {
     last_e_position = 0;
   #endif
 
+  #if ENABLED(MPCTEMP)
+    HOTEND_LOOP() temp_hotend[e].modeled_block_temp = NAN;  // Seeded on the first sample
+  #endif
+
   // Init (and disable) SPI thermocouples
   #if TEMP_SENSOR_IS_ANY_MAX_TC(0) && PIN_EXISTS(TEMP_0_CS)
     OUT_WRITE(TEMP_0_CS_PIN, HIGH);
@@ -2910,9 +3195,9 @@ void Temperature::update_raw_temperatures() {
 void Temperature::readings_ready() {
 
   // Update raw values only if they're not already set.
-  if (!raw_temps_ready) {
+  if (!load_acquire(raw_temps_ready)) {
     update_raw_temperatures();
-    raw_temps_ready = true;
+    store_release(raw_temps_ready, true);
   }
 
   // Filament Sensor - can be read any time since IIR filtering is used
@@ -3629,6 +3914,7 @@ void Temperature::isr() {
       #if ENABLED(AUTOTEMP)
         REMEMBER(1, planner.autotemp_enabled, false);
       #endif
+      TERN_(PLANNER_STARVATION_MONITOR, PlannerMonitor::Wait monitor_wait);
 
       #if TEMP_RESIDENCY_TIME > 0
         millis_t residency_start_ms = 0;
@@ -3765,6 +4051,8 @@ void Temperature::isr() {
     bool Temperature::wait_for_bed(const bool no_wait_for_cooling/*=true*/
       OPTARG(G26_CLICK_CAN_CANCEL, const bool click_to_cancel/*=false*/)
     ) {
+      TERN_(PLANNER_STARVATION_MONITOR, PlannerMonitor::Wait monitor_wait);
+
       #if TEMP_BED_RESIDENCY_TIME > 0
         millis_t residency_start_ms = 0;
         bool first_loop = true;
@@ -3963,6 +4251,8 @@ void Temperature::isr() {
     #endif
 
     bool Temperature::wait_for_chamber(const bool no_wait_for_cooling/*=true*/) {
+      TERN_(PLANNER_STARVATION_MONITOR, PlannerMonitor::Wait monitor_wait);
+
       #if TEMP_CHAMBER_RESIDENCY_TIME > 0
         millis_t residency_start_ms = 0;
         bool first_loop = true;
@@ -28,6 +28,7 @@
 #include "thermistor/thermistors.h"
 
 #include "../inc/MarlinConfig.h"
+#include "../libs/spsc_queue.h"
 
 #if ENABLED(AUTO_POWER_CONTROL)
   #include "../feature/power.h"
@@ -77,6 +78,18 @@ hotend_pid_t;
   typedef IF<(LPQ_MAX_LEN > 255), uint16_t, uint8_t>::type lpq_ptr_t;
 #endif
 
+#if ENABLED(MPCTEMP)
+  // Physical model of a hotend for Model Predictive Control (M306)
+  typedef struct {
+    float heater_power;                 // M306 P  (W)    Heater power at full duty
+    float block_heat_capacity;          // M306 C  (J/K)  Heat capacity of block and nozzle
+    float sensor_responsiveness;        // M306 R  (1/s)  How fast the sensor follows the block
+    float ambient_xfer_coeff_fan0;      // M306 A  (W/K)  Losses to ambient with the fan off
+    float ambient_xfer_coeff_fan255;    // M306 F  (W/K)  Losses to ambient with the fan at full speed
+    float filament_heat_capacity_permm; // M306 H  (J/K/mm)
+  } MPC_t;
+#endif
+
 #define PID_PARAM(F,H) _PID_##F(TERN(PID_PARAMS_PER_HOTEND, H, 0 & H)) // Always use 'H' to suppress warning
 #define _PID_Kp(H) TERN(PIDTEMP, Temperature::temp_hotend[H].pid.Kp, NAN)
 #define _PID_Ki(H) TERN(PIDTEMP, Temperature::temp_hotend[H].pid.Ki, NAN)
@@ -181,6 +194,10 @@ enum ADCSensorState : char {
   #define unscalePID_d(d) ( float(d) * PID_dT )
 #endif
 
+#if ENABLED(MPCTEMP)
+  #define MPC_dT ((OVERSAMPLENR * float(ACTUAL_ADC_SAMPLES)) / TEMP_TIMER_FREQUENCY)
+#endif
+
 #if ENABLED(G26_MESH_VALIDATION) && EITHER(HAS_LCD_MENU, EXTENSIBLE_UI)
   #define G26_CLICK_CAN_CANCEL 1
 #endif
@@ -214,8 +231,20 @@ struct PIDHeaterInfo : public HeaterInfo {
   T pid;  // Initialized by settings.load()
 };
 
+// A heater controlled by a physical model
+#if ENABLED(MPCTEMP)
+  struct MPCHeaterInfo : public HeaterInfo {
+    MPC_t constants;                    // Initialized by settings.load()
+    float modeled_ambient_temp,
+          modeled_block_temp,
+          modeled_sensor_temp;
+  };
+#endif
+
 #if ENABLED(PIDTEMP)
   typedef struct PIDHeaterInfo<hotend_pid_t> hotend_info_t;
+#elif ENABLED(MPCTEMP)
+  typedef struct MPCHeaterInfo hotend_info_t;
 #else
   typedef heater_info_t hotend_info_t;
 #endif
@@ -884,6 +913,13 @@ class Temperature {
 
     #endif
 
+    #if ENABLED(MPCTEMP)
+      /**
+       * Identify the hotend model in response to M306 T
+       */
+      static void MPC_autotune(const uint8_t e, const celsius_t target);
+    #endif
+
     #if ENABLED(PROBING_HEATERS_OFF)
       static void pause_heaters(const bool p);
     #endif
@@ -930,14 +966,15 @@ class Temperature {
 
   private:
 
-    // Reading raw temperatures and converting to Celsius when ready
+    // Reading raw temperatures and converting to Celsius when ready.
+    // The ISR publishes the raw values with the flag, and the main loop hands them back by clearing it.
     static volatile bool raw_temps_ready;
     static void update_raw_temperatures();
     static void updateTemperaturesFromRawValues();
     static inline bool updateTemperaturesIfReady() {
-      if (!raw_temps_ready) return false;
+      if (!load_acquire(raw_temps_ready)) return false;
       updateTemperaturesFromRawValues();
-      raw_temps_ready = false;
+      store_release(raw_temps_ready, false);
       return true;
     }
 
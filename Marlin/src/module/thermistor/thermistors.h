@@ -335,6 +335,129 @@ static_assert(255 > TEMPTABLE_0_LEN || 255 > TEMPTABLE_1_LEN || 255 > TEMPTABLE_
   , "Temperature conversion tables over 255 entries need special consideration."
 );
 
+/**
+ * Bisect search for the range of the 'raw' value, then interpolate
+ * proportionally between the under and over values.
+ */
+#define SCAN_THERMISTOR_TABLE(TBL,LEN) do{                                \
+  uint8_t l = 0, r = LEN, m;                                              \
+  for (;;) {                                                              \
+    m = (l + r) >> 1;                                                     \
+    if (!m) return celsius_t(pgm_read_word(&TBL[0].celsius));             \
+    if (m == l || m == r) return celsius_t(pgm_read_word(&TBL[LEN-1].celsius)); \
+    int16_t v00 = pgm_read_word(&TBL[m-1].value),                         \
+            v10 = pgm_read_word(&TBL[m-0].value);                         \
+         if (raw < v00) r = m;                                            \
+    else if (raw > v10) l = m;                                            \
+    else {                                                                \
+      const celsius_t v01 = celsius_t(pgm_read_word(&TBL[m-1].celsius)),  \
+                      v11 = celsius_t(pgm_read_word(&TBL[m-0].celsius));  \
+      return v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00);     \
+    }                                                                     \
+  }                                                                       \
+}while(0)
+
+#if ENABLED(FAST_THERMISTOR_CONVERSION)
+
+  /**
+   * A conversion table resampled at compile time to one entry per ADC count
+   * (at the tables' 10-bit scale) in 1/16 °C. Each entry is what the table
+   * search gives for that count, so interpolating between two neighbours
+   * follows the table's lines exactly, except within the one count around
+   * a table point that isn't a whole count.
+   */
+  #define THERMISTOR_LOOKUP_STEP OV(1)
+  #define THERMISTOR_LOOKUP_SIZE (_BV(THERMISTOR_TABLE_ADC_RESOLUTION) + 1)
+
+  struct thermistor_lookup_t {
+    int16_t celsius16[THERMISTOR_LOOKUP_SIZE];
+
+    constexpr thermistor_lookup_t(const temp_entry_t * const tbl, const uint8_t len) : celsius16() {
+      for (uint16_t i = 0; i < THERMISTOR_LOOKUP_SIZE; ++i) {
+        const float c = scan(tbl, len, _MIN(int32_t(i) * (THERMISTOR_LOOKUP_STEP), int32_t(MAX_RAW_THERMISTOR_VALUE)));
+        celsius16[i] = int16_t(c * 16 + (c < 0 ? -0.5f : 0.5f));
+      }
+    }
+
+    // The same bisect search as SCAN_THERMISTOR_TABLE
+    static constexpr float scan(const temp_entry_t * const tbl, const uint8_t len, const int16_t raw) {
+      uint8_t l = 0, r = len;
+      for (;;) {
+        const uint8_t m = (l + r) >> 1;
+        if (!m) return tbl[0].celsius;
+        if (m == l || m == r) return tbl[len - 1].celsius;
+        const int16_t v00 = tbl[m - 1].value, v10 = tbl[m].value;
+             if (raw < v00) r = m;
+        else if (raw > v10) l = m;
+        else if (v10 == v00) return tbl[m - 1].celsius;
+        else return tbl[m - 1].celsius + (raw - v00) * float(tbl[m].celsius - tbl[m - 1].celsius) / float(v10 - v00);
+      }
+    }
+  };
+
+  // One instance per table in use, however many sensors share it
+  template<const temp_entry_t *TBL, uint8_t LEN>
+  constexpr thermistor_lookup_t thermistor_lookup PROGMEM = thermistor_lookup_t(TBL, LEN);
+
+  /**
+   * Index the table resampled to one entry per ADC count, then
+   * interpolate between that entry and the next.
+   */
+  #define LOOKUP_THERMISTOR_TABLE(LUT) do{                                     \
+    const int16_t r = constrain(raw, 0, int16_t(MAX_RAW_THERMISTOR_VALUE));    \
+    const uint16_t i = uint16_t(r) / (THERMISTOR_LOOKUP_STEP);                 \
+    const int16_t c0 = pgm_read_word(&LUT.celsius16[i]),                       \
+                  c1 = pgm_read_word(&LUT.celsius16[i + 1]);                   \
+    const int32_t frac = r - i * (THERMISTOR_LOOKUP_STEP);                     \
+    return (int32_t(c0) * (THERMISTOR_LOOKUP_STEP) + (c1 - c0) * frac)         \
+           * (1.0f / (16 * (THERMISTOR_LOOKUP_STEP)));                         \
+  }while(0)
+
+  // Hotends are converted through a table of pointers. Custom thermistors have no table.
+  #define _TT_LOOKUP(N) (&thermistor_lookup<TEMPTABLE_##N, TEMPTABLE_##N##_LEN>)
+  #if TEMP_SENSOR_0_IS_THERMISTOR && !TEMP_SENSOR_0_IS_CUSTOM
+    #define TEMPTABLE_0_LOOKUP _TT_LOOKUP(0)
+  #else
+    #define TEMPTABLE_0_LOOKUP nullptr
+  #endif
+  #if TEMP_SENSOR_1_IS_THERMISTOR && !TEMP_SENSOR_1_IS_CUSTOM
+    #define TEMPTABLE_1_LOOKUP _TT_LOOKUP(1)
+  #else
+    #define TEMPTABLE_1_LOOKUP nullptr
+  #endif
+  #if TEMP_SENSOR_2_IS_THERMISTOR && !TEMP_SENSOR_2_IS_CUSTOM
+    #define TEMPTABLE_2_LOOKUP _TT_LOOKUP(2)
+  #else
+    #define TEMPTABLE_2_LOOKUP nullptr
+  #endif
+  #if TEMP_SENSOR_3_IS_THERMISTOR && !TEMP_SENSOR_3_IS_CUSTOM
+    #define TEMPTABLE_3_LOOKUP _TT_LOOKUP(3)
+  #else
+    #define TEMPTABLE_3_LOOKUP nullptr
+  #endif
+  #if TEMP_SENSOR_4_IS_THERMISTOR && !TEMP_SENSOR_4_IS_CUSTOM
+    #define TEMPTABLE_4_LOOKUP _TT_LOOKUP(4)
+  #else
+    #define TEMPTABLE_4_LOOKUP nullptr
+  #endif
+  #if TEMP_SENSOR_5_IS_THERMISTOR && !TEMP_SENSOR_5_IS_CUSTOM
+    #define TEMPTABLE_5_LOOKUP _TT_LOOKUP(5)
+  #else
+    #define TEMPTABLE_5_LOOKUP nullptr
+  #endif
+  #if TEMP_SENSOR_6_IS_THERMISTOR && !TEMP_SENSOR_6_IS_CUSTOM
+    #define TEMPTABLE_6_LOOKUP _TT_LOOKUP(6)
+  #else
+    #define TEMPTABLE_6_LOOKUP nullptr
+  #endif
+  #if TEMP_SENSOR_7_IS_THERMISTOR && !TEMP_SENSOR_7_IS_CUSTOM
+    #define TEMPTABLE_7_LOOKUP _TT_LOOKUP(7)
+  #else
+    #define TEMPTABLE_7_LOOKUP nullptr
+  #endif
+
+#endif // FAST_THERMISTOR_CONVERSION
+
 // Set the high and low raw values for the heaters
 // For thermistors the highest temperature results in the lowest ADC value
 // For thermocouples the highest temperature results in the highest ADC value
@@ -32,6 +32,13 @@ bool SDIO_WriteBlock(uint32_t block, const uint8_t *src);
 bool SDIO_IsReady();
 uint32_t SDIO_GetCardSize();
 
+#ifdef HAL_SDIO_DMA_ASYNC
+  bool SDIO_ReadBlocks(uint32_t block, uint8_t *dst, const uint32_t count);
+  bool SDIO_WriteBlocks(uint32_t block, const uint8_t *src, const uint32_t count);
+  bool SDIO_ReadBlocks_Async(uint32_t block, uint8_t *dst, const uint32_t count);
+  bool SDIO_Wait();
+#endif
+
 class DiskIODriver_SDIO : public DiskIODriver {
   public:
     bool init(const uint8_t sckRateID=0, const pin_t chipSelectPin=0) override { return SDIO_Init(); }
@@ -49,6 +56,13 @@ class DiskIODriver_SDIO : public DiskIODriver {
     bool readBlock(uint32_t block, uint8_t *dst)          override { return SDIO_ReadBlock(block, dst); }
     bool writeBlock(uint32_t block, const uint8_t *src)   override { return SDIO_WriteBlock(block, src); }
 
+    #ifdef HAL_SDIO_DMA_ASYNC
+      bool readBlocks(uint32_t block, uint8_t *dst, const uint16_t count)        override { return SDIO_ReadBlocks(block, dst, count); }
+      bool writeBlocks(uint32_t block, const uint8_t *src, const uint16_t count) override { return SDIO_WriteBlocks(block, src, count); }
+      bool readAheadStart(const uint32_t block, uint8_t *dst)                    override { return SDIO_ReadBlocks_Async(block, dst, 1); }
+      bool readAheadWait()                                                       override { return SDIO_Wait(); }
+    #endif
+
     uint32_t cardSize()                                   override { return SDIO_GetCardSize(); }
 
     bool isReady()                                        override { return SDIO_IsReady(); }
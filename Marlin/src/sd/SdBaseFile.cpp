@@ -49,6 +49,15 @@ void (*SdBaseFile::dateTime_)(uint16_t *date, uint16_t *time) = 0;
 bool SdBaseFile::addCluster() {
   if (ENABLED(SDCARD_READONLY)) return false;
 
+  #if ENABLED(SD_STREAMING_UPLOAD)
+    // Allocate a contiguous group, falling back to one cluster if there's no room
+    const uint32_t prev = curCluster_;
+    if (growClusters_ > 1 && vol_->allocContiguous(growClusters_, &curCluster_)) {
+      if (!(prev && prev == contigEnd_ && curCluster_ == prev + 1)) contigBgn_ = curCluster_;
+      contigEnd_ = curCluster_ + growClusters_ - 1;
+    }
+    else
+  #endif
   if (!vol_->allocContiguous(1, &curCluster_)) return false;
 
   // if first cluster of file link to directory entry
@@ -59,6 +68,107 @@ bool SdBaseFile::addCluster() {
   return true;
 }
 
+// Move curCluster_ to the cluster that begins at curPosition_
+bool SdBaseFile::advanceCluster() {
+  #if ENABLED(SD_EXTENT_CACHE)
+    const uint32_t index = curPosition_ >> (vol_->clusterSizeShift_ + 9);
+    if (extentLookup(index)) return true;
+  #endif
+
+  if (curPosition_ == 0)
+    curCluster_ = firstCluster_;                      // use first cluster in file
+  else if (!vol_->fatGet(curCluster_, &curCluster_)) // get next cluster from FAT
+    return false;
+
+  TERN_(SD_EXTENT_CACHE, extentAdd(index));
+  return true;
+}
+
+#if ENABLED(SD_STREAMING_UPLOAD)
+
+  /**
+   * Release clusters allocated ahead of the data. Called by every sync() so
+   * the chain on the card never runs past the size in the directory entry.
+   * Writing on after this allocates a new group.
+   */
+  bool SdBaseFile::trimPreallocation() {
+    if (!contigEnd_ || !isFile() || !(flags_ & O_WRITE)) return true;
+    contigClear();
+    if (fileSize_) return truncate(fileSize_);
+    if (!firstCluster_) return true;
+    // nothing was written so the whole chain goes
+    if (!vol_->freeChain(firstCluster_)) return false;
+    firstCluster_ = curCluster_ = 0;
+    flags_ |= F_FILE_DIR_DIRTY;
+    return true;
+  }
+
+#endif
+
+#if ENABLED(SD_EXTENT_CACHE)
+
+  /**
+   * Remember the run of contiguous clusters starting at curCluster_,
+   * the cluster at position 'index' within the file.
+   *
+   * The scan stops after one FAT block's worth of entries so a long
+   * contiguous file doesn't stall the caller. Reaching the end of a
+   * known run comes back here and grows the run instead.
+   */
+  void SdBaseFile::extentAdd(const uint32_t index) {
+    uint32_t c = curCluster_, count = 1;
+    for (uint8_t n = 128; n--; count++) {
+      uint32_t next;
+      if (!vol_->fatGet(c, &next) || next != c + 1) break;
+      c = next;
+    }
+
+    // Grow a run that ends right where this one begins
+    LOOP_L_N(i, extentCount_) {
+      extent_t &e = extent_[i];
+      if (e.index + e.count == index && e.cluster + e.count == curCluster_) {
+        e.count += count;
+        return;
+      }
+    }
+
+    // Use a free entry or replace the oldest
+    extent_t &e = extent_[extentNext_];
+    e.index = index;
+    e.cluster = curCluster_;
+    e.count = count;
+    if (extentCount_ < SD_EXTENT_CACHE_SIZE) extentCount_++;
+    if (++extentNext_ == SD_EXTENT_CACHE_SIZE) extentNext_ = 0;
+  }
+
+  // Set curCluster_ for the cluster at position 'index' if a known run covers it
+  bool SdBaseFile::extentLookup(const uint32_t index) {
+    LOOP_L_N(i, extentCount_) {
+      const extent_t &e = extent_[i];
+      if (index >= e.index && index - e.index < e.count) {
+        curCluster_ = e.cluster + (index - e.index);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Number of contiguous blocks from the current position to the end of its run
+  uint32_t SdBaseFile::extentBlocksLeft(const uint8_t blockOfCluster) {
+    const uint32_t index = curPosition_ >> (vol_->clusterSizeShift_ + 9);
+    uint32_t clusters = 1;
+    LOOP_L_N(i, extentCount_) {
+      const extent_t &e = extent_[i];
+      if (index >= e.index && index - e.index < e.count) {
+        clusters = e.count - (index - e.index);
+        break;
+      }
+    }
+    return (clusters << vol_->clusterSizeShift_) - blockOfCluster;
+  }
+
+#endif // SD_EXTENT_CACHE
+
 // Add a cluster to a directory file and zero the cluster.
 // return with first block of cluster in the cache
 bool SdBaseFile::addDirCluster() {
@@ -758,6 +868,11 @@ bool SdBaseFile::openCachedEntry(uint8_t dirIndex, uint8_t oflag) {
   // set to start of file
   curCluster_ = 0;
   curPosition_ = 0;
+  TERN_(SD_EXTENT_CACHE, extentClear());
+  #if ENABLED(SD_STREAMING_UPLOAD)
+    contigClear();
+    growClusters_ = 0;
+  #endif
   if ((oflag & O_TRUNC) && !truncate(0)) return false;
   return oflag & O_AT_END ? seekEnd(0) : true;
 
@@ -894,6 +1009,11 @@ bool SdBaseFile::openRoot(SdVolume *vol) {
 
   // set to start of file
   curCluster_ = curPosition_ = 0;
+  TERN_(SD_EXTENT_CACHE, extentClear());
+  #if ENABLED(SD_STREAMING_UPLOAD)
+    contigClear();
+    growClusters_ = 0;
+  #endif
 
   // root has no directory entry
   dirBlock_ = dirIndex_ = 0;
@@ -1020,12 +1140,29 @@ int16_t SdBaseFile::read(void *buf, uint16_t nbyte) {
       uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
       if (offset == 0 && blockOfCluster == 0) {
         // start of new cluster
-        if (curPosition_ == 0)
-          curCluster_ = firstCluster_;                      // use first cluster in file
-        else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
-          return -1;
+        if (!advanceCluster()) return -1;
       }
       block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
+
+      #if ENABLED(SD_EXTENT_CACHE)
+        // read whole blocks up to the end of the contiguous run with one command
+        if (offset == 0 && toRead >= 1024) {
+          uint32_t count = _MIN(extentBlocksLeft(blockOfCluster), uint32_t(toRead >> 9));
+          // stop short of the cached block, which may hold unwritten data
+          const uint32_t cached = vol_->cacheBlockNumber();
+          if (cached >= block && cached < block + count) count = cached - block;
+          if (count > 1) {
+            if (!vol_->readBlocks(block, dst, count)) return -1;
+            // leave curCluster_ at the cluster holding the last byte read
+            curCluster_ += (blockOfCluster + count - 1) >> vol_->clusterSizeShift_;
+            const uint16_t n = count << 9;
+            dst += n;
+            curPosition_ += n;
+            toRead -= n;
+            continue;
+          }
+        }
+      #endif
     }
     uint16_t n = toRead;
 
@@ -1041,6 +1178,12 @@ int16_t SdBaseFile::read(void *buf, uint16_t nbyte) {
       if (!vol_->cacheRawBlock(block, SdVolume::CACHE_FOR_READ)) return -1;
       uint8_t *src = vol_->cache()->data + offset;
       memcpy(dst, src, n);
+      #if ENABLED(SD_READ_AHEAD)
+        // fetch the next block of the cluster while this one is used
+        if (type_ != FAT_FILE_TYPE_ROOT_FIXED && vol_->blockOfCluster(curPosition_) < vol_->blocksPerCluster() - 1
+          && curPosition_ + 512 - offset < fileSize_
+        ) vol_->readAheadStart(block + 1);
+      #endif
     }
     dst += n;
     curPosition_ += n;
@@ -1488,6 +1631,14 @@ bool SdBaseFile::seekSet(const uint32_t pos) {
   nCur = (curPosition_ - 1) >> (vol_->clusterSizeShift_ + 9);
   nNew = (pos - 1) >> (vol_->clusterSizeShift_ + 9);
 
+  #if ENABLED(SD_EXTENT_CACHE)
+    // jump straight to the cluster if a known run covers it
+    if (extentLookup(nNew)) {
+      curPosition_ = pos;
+      return true;
+    }
+  #endif
+
   if (nNew < nCur || curPosition_ == 0)
     curCluster_ = firstCluster_;      // must follow chain from first cluster
   else
@@ -1517,6 +1668,10 @@ bool SdBaseFile::sync() {
   // only allow open files and directories
   if (ENABLED(SDCARD_READONLY) || !isOpen()) goto FAIL;
 
+  #if ENABLED(SD_STREAMING_UPLOAD)
+    if (!trimPreallocation()) goto FAIL;
+  #endif
+
   if (flags_ & F_FILE_DIR_DIRTY) {
     dir_t *d = cacheDirEntry(SdVolume::CACHE_FOR_WRITE);
     // check for deleted by another open file object
@@ -1681,6 +1836,10 @@ bool SdBaseFile::truncate(uint32_t length) {
   // remember position for seek after truncation
   newPos = curPosition_ > length ? length : curPosition_;
 
+  // freed clusters may be reused by a different chain
+  TERN_(SD_EXTENT_CACHE, extentClear());
+  TERN_(SD_STREAMING_UPLOAD, contigClear());
+
   // position to last cluster in truncated file
   if (!seekSet(length)) return false;
 
@@ -1760,6 +1919,10 @@ int16_t SdBaseFile::write(const void *buf, uint16_t nbyte) {
           curCluster_ = firstCluster_;
         }
       }
+      else if (TERN0(SD_STREAMING_UPLOAD, inContig(curCluster_) && curCluster_ < contigEnd_)) {
+        // inside an allocated run the next cluster needs no FAT lookup
+        curCluster_++;
+      }
       else {
         uint32_t next;
         if (!vol_->fatGet(curCluster_, &next)) goto FAIL;
@@ -1780,6 +1943,28 @@ int16_t SdBaseFile::write(const void *buf, uint16_t nbyte) {
 
     // block for data write
     uint32_t block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
+
+    #if ENABLED(SD_STREAMING_UPLOAD)
+      // write whole blocks up to the end of the allocated run with one command
+      if (blockOffset == 0 && nToWrite >= 1024) {
+        const uint32_t clusters = inContig(curCluster_) ? contigEnd_ - curCluster_ + 1 : 1;
+        const uint32_t count = _MIN((clusters << vol_->clusterSizeShift_) - blockOfCluster, uint32_t(nToWrite >> 9));
+        if (count > 1) {
+          // the cached block is about to be overwritten
+          const uint32_t cached = vol_->cacheBlockNumber();
+          if (cached >= block && cached < block + count) vol_->cacheSetBlockNumber(0xFFFFFFFF, false);
+          if (!vol_->writeBlocks(block, src, count)) goto FAIL;
+          // leave curCluster_ at the cluster holding the last byte written
+          curCluster_ += (blockOfCluster + count - 1) >> vol_->clusterSizeShift_;
+          n = count << 9;
+          curPosition_ += n;
+          src += n;
+          nToWrite -= n;
+          continue;
+        }
+      }
+    #endif
+
     if (n == 512) {
       // full block - don't need to use cache
       if (vol_->cacheBlockNumber() == block) {
@@ -343,6 +343,15 @@ class SdBaseFile {
   SdVolume* volume() const { return vol_; }
   int16_t write(const void *buf, uint16_t nbyte);
 
+  #if ENABLED(SD_STREAMING_UPLOAD)
+    /**
+     * Grow the file by 'clusters' contiguous clusters at a time while writing.
+     * Whole blocks inside a contiguous run go out with one multi-block write.
+     * Unused clusters are released by sync() and close(). 0 or 1 for normal growth.
+     */
+    void setPreallocation(const uint16_t clusters) { growClusters_ = clusters; }
+  #endif
+
  private:
   friend class SdFat;           // allow SdFat to set cwd_
   static SdBaseFile *cwd_;      // global pointer to cwd dir
@@ -366,6 +375,33 @@ class SdBaseFile {
   uint32_t  firstCluster_;  // first cluster of file
   SdVolume  *vol_;          // volume where file is located
 
+  #if ENABLED(SD_EXTENT_CACHE)
+    // A run of contiguous clusters, found lazily while following the FAT chain
+    struct extent_t {
+      uint32_t index;         // position of the run's first cluster within the file
+      uint32_t cluster;       // first volume cluster of the run
+      uint32_t count;         // number of clusters in the run
+    };
+    extent_t  extent_[SD_EXTENT_CACHE_SIZE];
+    uint8_t   extentCount_;   // extents in use
+    uint8_t   extentNext_;    // extent to replace when all are in use
+
+    void extentClear() { extentCount_ = extentNext_ = 0; }
+    void extentAdd(const uint32_t index);
+    bool extentLookup(const uint32_t index);
+    uint32_t extentBlocksLeft(const uint8_t blockOfCluster);
+  #endif
+
+  #if ENABLED(SD_STREAMING_UPLOAD)
+    uint16_t  growClusters_;  // clusters to allocate when the chain runs out
+    uint32_t  contigBgn_,     // every cluster from contigBgn_ to contigEnd_
+              contigEnd_;     // is followed by the next one in the chain
+
+    void contigClear() { contigBgn_ = contigEnd_ = 0; }
+    bool inContig(const uint32_t cluster) const { return contigEnd_ && cluster >= contigBgn_ && cluster <= contigEnd_; }
+    bool trimPreallocation();
+  #endif
+
   /**
    * EXPERIMENTAL - Don't use!
    */
@@ -374,6 +410,7 @@ class SdBaseFile {
   // private functions
   bool addCluster();
   bool addDirCluster();
+  bool advanceCluster();
   dir_t* cacheDirEntry(uint8_t action);
   int8_t lsPrintNext(uint8_t flags, uint8_t indent);
   static bool make83Name(const char *str, uint8_t *name, const char **ptr);
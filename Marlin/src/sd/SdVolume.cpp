@@ -37,6 +37,10 @@
 
 #include "../MarlinCore.h"
 
+#if ENABLED(EVENT_TRACE)
+  #include "../feature/event_trace.h"
+#endif
+
 #if !USE_MULTIPLE_CARDS
   // raw block cache
   uint32_t SdVolume::cacheBlockNumber_;  // current block number
@@ -46,6 +50,15 @@
   uint32_t SdVolume::cacheMirrorBlock_;  // mirror  block for second FAT
 #endif
 
+#if ENABLED(SD_READ_AHEAD) && !USE_MULTIPLE_CARDS
+  cache_t  SdVolume::aheadBuffer_;       // block read in the background
+  uint32_t SdVolume::aheadBlock_ = 0xFFFFFFFF;
+#endif
+
+#if ENABLED(SD_EXTENT_CACHE)
+  sd_read_stats_t SdVolume::readStats;   // read throughput counters
+#endif
+
 // find a contiguous group of clusters
 bool SdVolume::allocContiguous(uint32_t count, uint32_t *curCluster) {
   if (ENABLED(SDCARD_READONLY)) return false;
@@ -123,6 +136,7 @@ bool SdVolume::allocContiguous(uint32_t count, uint32_t *curCluster) {
 bool SdVolume::cacheFlush() {
   #if DISABLED(SDCARD_READONLY)
     if (cacheDirty_) {
+      TERN_(SD_READ_AHEAD, readAheadDrop());
       if (!sdCard_->writeBlock(cacheBlockNumber_, cacheBuffer_.data))
         return false;
 
@@ -141,13 +155,78 @@ bool SdVolume::cacheFlush() {
 bool SdVolume::cacheRawBlock(uint32_t blockNumber, bool dirty) {
   if (cacheBlockNumber_ != blockNumber) {
     if (!cacheFlush()) return false;
-    if (!sdCard_->readBlock(blockNumber, cacheBuffer_.data)) return false;
+    TERN_(SD_EXTENT_CACHE, const uint32_t start_us = micros());
+    TERN_(EVENT_TRACE, event_trace.record(EV_SD_READ_BEGIN, 1, blockNumber));
+    const bool ok = TERN0(SD_READ_AHEAD, readAheadTake(blockNumber)) || sdCard_->readBlock(blockNumber, cacheBuffer_.data);
+    TERN_(EVENT_TRACE, event_trace.record(EV_SD_READ_END, !ok));
+    if (!ok) return false;
+    TERN_(SD_EXTENT_CACHE, countRead(1, start_us));
     cacheBlockNumber_ = blockNumber;
   }
   if (dirty) cacheDirty_ = true;
   return true;
 }
 
+#if ENABLED(SD_READ_AHEAD)
+
+  // Start reading a block in the background, if the card can
+  void SdVolume::readAheadStart(const uint32_t blockNumber) {
+    if (aheadBlock_ == blockNumber || blockNumber == cacheBlockNumber_) return;
+    readAheadDrop();
+    if (sdCard_->readAheadStart(blockNumber, aheadBuffer_.data)) aheadBlock_ = blockNumber;
+  }
+
+  // Fill the cache from the block read in the background, if it's the one wanted
+  bool SdVolume::readAheadTake(const uint32_t blockNumber) {
+    if (aheadBlock_ != blockNumber) { readAheadDrop(); return false; }
+    aheadBlock_ = 0xFFFFFFFF;
+    if (!sdCard_->readAheadWait()) return false;
+    memcpy(cacheBuffer_.data, aheadBuffer_.data, 512);
+    return true;
+  }
+
+  // Forget the background block before the card is written
+  void SdVolume::readAheadDrop() {
+    if (aheadBlock_ == 0xFFFFFFFF) return;
+    aheadBlock_ = 0xFFFFFFFF;
+    sdCard_->readAheadWait();
+  }
+
+#endif
+
+#if ENABLED(SD_EXTENT_CACHE)
+
+  void SdVolume::countRead(const uint16_t blocks, const uint32_t start_us) {
+    readStats.blocks += blocks;
+    readStats.commands++;
+    readStats.usec += micros() - start_us;
+  }
+
+  // Read consecutive blocks into the caller's buffer, bypassing the cache
+  bool SdVolume::readBlocks(uint32_t block, uint8_t *dst, const uint16_t count) {
+    const uint32_t start_us = micros();
+    TERN_(SD_READ_AHEAD, readAheadDrop());
+    // One multi-block command for the whole run
+    TERN_(EVENT_TRACE, event_trace.record(EV_SD_READ_BEGIN, _MIN(count, 255U), block));
+    const bool ok = count == 1 ? sdCard_->readBlock(block, dst) : sdCard_->readBlocks(block, dst, count);
+    TERN_(EVENT_TRACE, event_trace.record(EV_SD_READ_END, !ok));
+    if (!ok) return false;
+    countRead(count, start_us);
+    return true;
+  }
+
+#endif
+
+#if ENABLED(SD_STREAMING_UPLOAD)
+
+  // Write consecutive blocks from the caller's buffer, bypassing the cache
+  bool SdVolume::writeBlocks(uint32_t block, const uint8_t *src, const uint16_t count) {
+    TERN_(SD_READ_AHEAD, readAheadDrop());
+    return sdCard_->writeBlocks(block, src, count);
+  }
+
+#endif
+
 // return the size in bytes of a cluster chain
 bool SdVolume::chainSize(uint32_t cluster, uint32_t *size) {
   uint32_t s = 0;
@@ -187,8 +266,10 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t *value) {
   else
     return false;
 
-  if (lba != cacheBlockNumber_ && !cacheRawBlock(lba, CACHE_FOR_READ))
-    return false;
+  if (lba != cacheBlockNumber_) {
+    TERN_(SD_EXTENT_CACHE, readStats.fatReads++);
+    if (!cacheRawBlock(lba, CACHE_FOR_READ)) return false;
+  }
 
   *value = (fatType_ == 16) ? cacheBuffer_.fat16[cluster & 0xFF] : (cacheBuffer_.fat32[cluster & 0x7F] & FAT32MASK);
   return true;
@@ -336,6 +417,7 @@ bool SdVolume::init(DiskIODriver* dev, uint8_t part) {
   cacheDirty_ = 0;  // cacheFlush() will write block if true
   cacheMirrorBlock_ = 0;
   cacheBlockNumber_ = 0xFFFFFFFF;
+  TERN_(SD_READ_AHEAD, aheadBlock_ = 0xFFFFFFFF);
 
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
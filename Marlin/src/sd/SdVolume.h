@@ -64,6 +64,18 @@ union cache_t {
   fat32_fsinfo_t  fsinfo;     // Used to access to a cached FAT32 FSINFO sector.
 };
 
+#if ENABLED(SD_EXTENT_CACHE)
+  /**
+   * \brief Counters for data read from the card, reported by M27 T
+   */
+  struct sd_read_stats_t {
+    uint32_t blocks,      // Blocks transferred from the card
+             commands,    // Read commands issued (single or multi-block)
+             fatReads,    // FAT blocks fetched to follow cluster chains
+             usec;        // Time spent waiting on the card
+  };
+#endif
+
 /**
  * \class SdVolume
  * \brief Access FAT16 and FAT32 volumes on SD and SDHC cards.
@@ -129,6 +141,11 @@ class SdVolume {
    */
   bool dbgFat(uint32_t n, uint32_t *v) { return fatGet(n, v); }
 
+  #if ENABLED(SD_EXTENT_CACHE)
+    static sd_read_stats_t readStats;
+    static void resetReadStats() { readStats = { 0 }; }
+  #endif
+
  private:
   // Allow SdBaseFile access to SdVolume private data.
   friend class SdBaseFile;
@@ -152,6 +169,16 @@ class SdVolume {
     static uint32_t cacheMirrorBlock_;  // block number for mirror FAT
   #endif
 
+  #if ENABLED(SD_READ_AHEAD)
+    #if USE_MULTIPLE_CARDS
+      cache_t aheadBuffer_;              // next block, read while the cached one is used
+      uint32_t aheadBlock_;              // block being read into aheadBuffer_
+    #else
+      static cache_t aheadBuffer_;       // next block, read while the cached one is used
+      static uint32_t aheadBlock_;       // block being read into aheadBuffer_
+    #endif
+  #endif
+
   uint32_t allocSearchStart_;   // start cluster for alloc search
   uint8_t blocksPerCluster_;    // cluster size in blocks
   uint32_t blocksPerFat_;       // FAT size in blocks
@@ -180,6 +207,18 @@ class SdVolume {
     static bool cacheRawBlock(uint32_t blockNumber, bool dirty);
   #endif
 
+  #if ENABLED(SD_READ_AHEAD)
+    #if USE_MULTIPLE_CARDS
+      void readAheadStart(const uint32_t blockNumber);
+      bool readAheadTake(const uint32_t blockNumber);
+      void readAheadDrop();
+    #else
+      static void readAheadStart(const uint32_t blockNumber);
+      static bool readAheadTake(const uint32_t blockNumber);
+      static void readAheadDrop();
+    #endif
+  #endif
+
   // used by SdBaseFile write to assign cache to SD location
   void cacheSetBlockNumber(uint32_t blockNumber, bool dirty) {
     cacheDirty_ = dirty;
@@ -196,6 +235,29 @@ class SdVolume {
     if (fatType_ == 16) return cluster >= FAT16EOC_MIN;
     return  cluster >= FAT32EOC_MIN;
   }
-  bool readBlock(uint32_t block, uint8_t *dst) { return sdCard_->readBlock(block, dst); }
-  bool writeBlock(uint32_t block, const uint8_t *dst) { return sdCard_->writeBlock(block, dst); }
+  #if ENABLED(SD_EXTENT_CACHE)
+    static void countRead(const uint16_t blocks, const uint32_t start_us);
+    bool readBlock(uint32_t block, uint8_t *dst) { return readBlocks(block, dst, 1); }
+    #if USE_MULTIPLE_CARDS
+      bool readBlocks(uint32_t block, uint8_t *dst, const uint16_t count);
+    #else
+      static bool readBlocks(uint32_t block, uint8_t *dst, const uint16_t count);
+    #endif
+  #else
+    bool readBlock(uint32_t block, uint8_t *dst) {
+      TERN_(SD_READ_AHEAD, readAheadDrop());
+      return sdCard_->readBlock(block, dst);
+    }
+  #endif
+  bool writeBlock(uint32_t block, const uint8_t *dst) {
+    TERN_(SD_READ_AHEAD, readAheadDrop());
+    return sdCard_->writeBlock(block, dst);
+  }
+  #if ENABLED(SD_STREAMING_UPLOAD)
+    #if USE_MULTIPLE_CARDS
+      bool writeBlocks(uint32_t block, const uint8_t *src, const uint16_t count);
+    #else
+      static bool writeBlocks(uint32_t block, const uint8_t *src, const uint16_t count);
+    #endif
+  #endif
 };
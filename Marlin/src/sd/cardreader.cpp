@@ -143,6 +143,13 @@ SdFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_STREAMING_UPLOAD)
+  uint8_t CardReader::upload_buffer[SD_UPLOAD_BUFFER_BLOCKS * 512];
+  uint16_t CardReader::upload_count; // = 0
+  uint32_t CardReader::upload_bytes, CardReader::upload_ms;
+  long CardReader::upload_line_first = -1, CardReader::upload_line_last = -1;
+#endif
+
 CardReader::CardReader() {
   changeMedia(&
     #if HAS_USB_FLASH_DRIVE && !SHARED_VOLUME_IS(SD_ONBOARD)
@@ -568,7 +575,11 @@ void CardReader::endFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/))
   TERN_(ADVANCED_PAUSE_FEATURE, did_pause_print = 0);
   TERN_(HAS_DWIN_E3V2_BASIC, HMI_flag.print_finish = flag.sdprinting);
   flag.abort_sd_printing = false;
-  if (isFileOpen()) file.close();
+  if (isFileOpen()) {
+    TERN_(SD_STREAMING_UPLOAD, if (!flush_upload()) upload_error()); // An unfinished upload keeps what was received
+    file.close();
+  }
+  TERN_(SD_COMPRESSED_GCODE, flag.compressed = false);
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
@@ -673,7 +684,13 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (!fname) return;
 
   if (file.open(diveDir, fname, O_READ)) {
-    filesize = file.fileSize();
+    #if ENABLED(SD_COMPRESSED_GCODE)
+      // Compressed files report the size of the G-code they hold
+      flag.compressed = CompressedGcode::open(file);
+      filesize = flag.compressed ? CompressedGcode::size() : file.fileSize();
+    #else
+      filesize = file.fileSize();
+    #endif
     sdpos = 0;
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
@@ -708,10 +725,22 @@ void CardReader::openFileWrite(const char * const path) {
   const char * const fname = diveToFile(false, diveDir, path);
   if (!fname) return;
 
+  // Files are written as plain G-code
+  TERN_(SD_COMPRESSED_GCODE, flag.compressed = false);
+
   #if ENABLED(SDCARD_READONLY)
     openFailed(fname);
   #else
     if (file.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
+      #if ENABLED(SD_STREAMING_UPLOAD)
+        // Log files grow slowly so they keep the usual cluster-at-a-time growth
+        if (!flag.logging)
+          file.setPreallocation(_MAX(1U, uint16_t((SD_UPLOAD_PREALLOCATE) * 2UL >> volume.clusterSizeShift())));
+        upload_count = 0;
+        upload_line_first = upload_line_last = -1;
+        upload_bytes = 0;
+        upload_ms = millis();
+      #endif
       flag.saving = true;
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
@@ -797,11 +826,72 @@ void CardReader::write_command(char * const buf) {
   end[1] = '\r';
   end[2] = '\n';
   end[3] = '\0';
-  file.write(begin);
-
-  if (file.writeError) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
+  #if ENABLED(SD_STREAMING_UPLOAD)
+    // The buffer goes to the file later, so keep track of the lines it holds
+    const long line = npos ? strtol(npos + 1, nullptr, 10) : -1;
+    const uint16_t len = end + 3 - begin, before = upload_count;
+    if (!before) upload_line_first = line;
+    upload_line_last = line;
+    if (write(begin, len) < 0) {
+      file.writeError = true;
+      upload_error();
+      upload_line_first = upload_line_last = -1;
+    }
+    else if (upload_count != before + len)  // The buffer was written and what's left is from this line
+      upload_line_first = upload_count ? line : -1;
+  #else
+    file.write(begin);
+    if (file.writeError) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
+  #endif
 }
 
+#if ENABLED(SD_STREAMING_UPLOAD)
+
+  /**
+   * Copy data into the upload buffer, writing it out each time it fills.
+   * Full buffers are block-aligned, so the file gets whole blocks that
+   * can go to the card with one multi-block command.
+   */
+  int16_t CardReader::write(void *buf, uint16_t nbyte) {
+    if (!file.isOpen()) return -1;
+    const uint8_t *src = (const uint8_t*)buf;
+    for (uint16_t left = nbyte; left;) {
+      const uint16_t n = _MIN(left, uint16_t(sizeof(upload_buffer) - upload_count));
+      memcpy(&upload_buffer[upload_count], src, n);
+      upload_count += n;
+      src += n;
+      left -= n;
+      if (upload_count == sizeof(upload_buffer) && !flush_upload()) return -1;
+    }
+    upload_bytes += nbyte;
+    // A log should reach the card line by line
+    if (flag.logging && !flush_upload()) return -1;
+    return nbyte;
+  }
+
+  bool CardReader::flush_upload() {
+    if (!upload_count) return true;
+    const bool ok = file.write(upload_buffer, upload_count) >= 0;
+    upload_count = 0;
+    return ok;
+  }
+
+  // A failed buffer write loses the lines it held, so name them
+  void CardReader::upload_error() {
+    if (upload_line_first < 0 || upload_line_last < 0)
+      SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
+    else
+      SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE " (N", upload_line_first, "-N", upload_line_last, ")");
+  }
+
+  void CardReader::report_upload() {
+    const uint32_t ms = flag.saving ? millis() - upload_ms : upload_ms;
+    const float kbps = ms ? upload_bytes / 1.024f / ms : 0;
+    SERIAL_ECHOLNPGM("SD upload: ", upload_bytes, " bytes in ", ms, "ms (", kbps, "KB/s)");
+  }
+
+#endif
+
 #if DISABLED(NO_SD_AUTOSTART)
   /**
    * Run all the auto#.g files. Called:
@@ -846,9 +936,15 @@ void CardReader::write_command(char * const buf) {
 #endif
 
 void CardReader::closefile(const bool store_location/*=false*/) {
+  #if ENABLED(SD_STREAMING_UPLOAD)
+    if (file.isOpen() && !flush_upload()) upload_error();
+    upload_line_first = upload_line_last = -1;
+    if (flag.saving) upload_ms = millis() - upload_ms;
+  #endif
   file.sync();
   file.close();
   flag.saving = flag.logging = false;
+  TERN_(SD_COMPRESSED_GCODE, flag.compressed = false);
   sdpos = 0;
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
@@ -83,6 +83,9 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1
        #endif
+       #if ENABLED(SD_COMPRESSED_GCODE)
+         , compressed:1
+       #endif
     ;
 } card_flags_t;
 
@@ -90,6 +93,10 @@ typedef struct {
   #include "../libs/autoreport.h"
 #endif
 
+#if ENABLED(SD_COMPRESSED_GCODE)
+  #include "compressed_gcode.h"
+#endif
+
 class CardReader {
 public:
   static card_flags_t flag;                         // Flags (above)
@@ -223,10 +230,33 @@ public:
   static inline bool eof()              { return getIndex() >= getFileSize(); }
 
   // File data operations
-  static inline int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
+  #if ENABLED(SD_COMPRESSED_GCODE)
+    static inline int16_t get() {
+      if (flag.compressed) {
+        const int16_t out = CompressedGcode::get(file);
+        sdpos = out < 0 ? filesize : CompressedGcode::position(); // Damaged data ends the print
+        return out;
+      }
+      int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out;
+    }
+  #else
+    static inline int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
+  #endif
   static inline int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
-  static inline int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
-  static inline void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  #if ENABLED(SD_STREAMING_UPLOAD)
+    static int16_t write(void *buf, uint16_t nbyte);
+    static void report_upload();  // Used by M29 and M27 T
+  #else
+    static inline int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
+  #endif
+  #if ENABLED(SD_COMPRESSED_GCODE)
+    static inline void setIndex(const uint32_t index) {
+      if (!flag.compressed) file.seekSet((sdpos = index));
+      else sdpos = CompressedGcode::seek(file, index) ? index : filesize;
+    }
+  #else
+    static inline void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  #endif
 
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
@@ -319,6 +349,16 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  #if ENABLED(SD_STREAMING_UPLOAD)
+    // Written data is gathered into whole blocks before going to the file
+    static uint8_t upload_buffer[SD_UPLOAD_BUFFER_BLOCKS * 512];
+    static uint16_t upload_count;
+    static uint32_t upload_bytes, upload_ms; // Size and duration of the current or last upload
+    static long upload_line_first, upload_line_last; // Numbered lines held in the buffer, or -1
+    static bool flush_upload();
+    static void upload_error();
+  #endif
+
   //
   // Procedure calls to other files
   //
@@ -0,0 +1,136 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_COMPRESSED_GCODE)
+
+#include "compressed_gcode.h"
+#include "../libs/heatshrink/heatshrink_decoder.h"
+
+static heatshrink_decoder hsd;
+
+uint32_t CompressedGcode::gcode_size, CompressedGcode::index_offset,
+         CompressedGcode::pos, CompressedGcode::block_left;
+uint16_t CompressedGcode::in_left;
+uint8_t CompressedGcode::block_shift, CompressedGcode::out_index, CompressedGcode::out_count,
+        CompressedGcode::out_buffer[64];
+
+struct [[gnu::packed]] compressed_header_t {
+  char magic[4];
+  uint8_t version, window, lookahead, block_shift;
+  uint32_t size, index;
+};
+
+bool CompressedGcode::open(SdFile &file) {
+  compressed_header_t h;
+  const bool is_compressed = file.read(&h, sizeof(h)) == int16_t(sizeof(h))
+                          && !memcmp(h.magic, COMPRESSED_GCODE_MAGIC, sizeof(h.magic));
+  if (!is_compressed) { file.seekSet(0); return false; }
+
+  if (h.version != COMPRESSED_GCODE_VERSION || h.window != HEATSHRINK_STATIC_WINDOW_BITS
+    || h.lookahead != HEATSHRINK_STATIC_LOOKAHEAD_BITS || !WITHIN(h.block_shift, 8, 15)
+  ) {
+    SERIAL_ECHO_MSG("Unsupported compressed file: v", h.version, " w", h.window, " l", h.lookahead, " b", h.block_shift);
+    gcode_size = pos = 0;   // Read as an empty file
+    out_index = out_count = 0;
+    block_left = 0;
+    return true;
+  }
+
+  gcode_size = h.size;
+  index_offset = h.index;
+  block_shift = h.block_shift;
+  pos = block_left = 0;
+  out_index = out_count = 0;
+  return true;
+}
+
+bool CompressedGcode::damaged() {
+  SERIAL_ERROR_MSG(STR_SD_ERR_READ);
+  return false;
+}
+
+// Begin decoding the block at the current file position
+bool CompressedGcode::start_block(SdFile &file) {
+  if (file.read(&in_left, sizeof(in_left)) != int16_t(sizeof(in_left))) return false;
+  heatshrink_decoder_reset(&hsd);
+  block_left = _MIN(gcode_size - pos, uint32_t(1) << block_shift);
+  return true;
+}
+
+/**
+ * Decode more of the current block, or start the next one.
+ * Compressed data is fed to the decoder as it asks for it,
+ * a decoder's input buffer at a time.
+ */
+bool CompressedGcode::refill(SdFile &file) {
+  out_index = out_count = 0;
+  if (!block_left) {
+    if (pos >= gcode_size) return false;
+    if (!start_block(file)) return damaged();
+  }
+
+  for (;;) {
+    size_t count;
+    heatshrink_decoder_poll(&hsd, out_buffer, _MIN(uint32_t(sizeof(out_buffer)), block_left), &count);
+    if (count) {
+      out_count = count;
+      block_left -= count;
+      return true;
+    }
+
+    // The decoder has used up its input
+    if (!in_left) return damaged();
+    uint8_t in[HEATSHRINK_STATIC_INPUT_BUFFER_SIZE];
+    const uint16_t n = _MIN(in_left, uint16_t(sizeof(in)));
+    if (file.read(in, n) != int16_t(n)) return damaged();
+    in_left -= n;
+    heatshrink_decoder_sink(&hsd, in, n, &count);
+  }
+}
+
+/**
+ * Find the block holding the target from the index at the end of the
+ * file, then decode and discard up to the target within that block.
+ */
+bool CompressedGcode::seek(SdFile &file, const uint32_t target) {
+  if (target > gcode_size) return false;
+
+  out_index = out_count = 0;
+  block_left = 0;
+
+  const uint32_t block = target >> block_shift;
+  pos = block << block_shift;
+  if (pos < gcode_size) {
+    uint32_t offset;
+    if (!file.seekSet(index_offset + block * sizeof(offset))
+      || file.read(&offset, sizeof(offset)) != int16_t(sizeof(offset))
+      || !file.seekSet(offset)
+    ) return damaged();
+  }
+
+  while (pos < target) if (get(file) < 0) return false;
+  return true;
+}
+
+#endif // SD_COMPRESSED_GCODE
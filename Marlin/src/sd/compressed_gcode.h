@@ -0,0 +1,79 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Compressed G-code files
+ *
+ * A file made by buildroot/share/scripts/gcode_compress.py holds G-code
+ * in independently compressed heatshrink blocks, so printing can start
+ * or resume at any position after decompressing at most one block.
+ *
+ * Layout (little-endian):
+ *   char    magic[4]      "MHSG"
+ *   uint8   version       1
+ *   uint8   window        Heatshrink window bits. Must match HEATSHRINK_STATIC_WINDOW_BITS.
+ *   uint8   lookahead     Heatshrink lookahead bits. Must match HEATSHRINK_STATIC_LOOKAHEAD_BITS.
+ *   uint8   block_shift   Each block holds (1 << block_shift) bytes of G-code, the last one fewer
+ *   uint32  size          Total size of the G-code
+ *   uint32  index         File offset of the block index
+ *   { uint16 length, uint8 data[length] }[blocks]
+ *   uint32  offset[blocks]  File offset of each block's length field
+ *
+ * Positions seen by the rest of the firmware (sdpos, M26, power-loss
+ * recovery, M808 markers) are offsets into the decompressed G-code.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#include "SdFile.h"
+
+#define COMPRESSED_GCODE_MAGIC "MHSG"
+#define COMPRESSED_GCODE_VERSION 1
+
+class CompressedGcode {
+public:
+  // Check the file for a compressed header and prepare to read from the start
+  static bool open(SdFile &file);
+
+  static uint32_t size() { return gcode_size; }
+  static uint32_t position() { return pos; }
+
+  // Next byte of G-code, or -1 at the end or on error
+  static inline int16_t get(SdFile &file) {
+    if (out_index == out_count && !refill(file)) return -1;
+    pos++;
+    return out_buffer[out_index++];
+  }
+
+  // Move to a position in the G-code
+  static bool seek(SdFile &file, const uint32_t target);
+
+private:
+  static uint32_t gcode_size, index_offset, pos, block_left;
+  static uint16_t in_left;
+  static uint8_t block_shift, out_index, out_count, out_buffer[64];
+
+  static bool refill(SdFile &file);
+  static bool start_block(SdFile &file);
+  static bool damaged();
+};
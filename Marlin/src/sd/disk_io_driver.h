@@ -59,6 +59,31 @@ public:
   virtual bool readBlock(uint32_t block, uint8_t* dst) = 0;
   virtual bool writeBlock(uint32_t blockNumber, const uint8_t* src) = 0;
 
+  /**
+   * Transfer consecutive blocks with one command. Drivers with a faster
+   * way than readData / writeData for each block override these.
+   */
+  virtual bool readBlocks(uint32_t block, uint8_t* dst, const uint16_t count) {
+    if (!readStart(block)) return false;
+    for (uint16_t i = 0; i < count; i++, dst += 512)
+      if (!readData(dst)) { readStop(); return false; }
+    return readStop();
+  }
+  virtual bool writeBlocks(uint32_t block, const uint8_t* src, const uint16_t count) {
+    if (!writeStart(block, count)) return false;
+    for (uint16_t i = 0; i < count; i++, src += 512)
+      if (!writeData(src)) { writeStop(); return false; }
+    return writeStop();
+  }
+
+  /**
+   * Start reading a block in the background, if the driver can. Other
+   * calls wait for it to finish first. The data may be used once
+   * readAheadWait() returns true. 'dst' must stay valid until then.
+   */
+  virtual bool readAheadStart(const uint32_t, uint8_t*) { return false; }
+  virtual bool readAheadWait() { return false; }
+
   virtual uint32_t cardSize() = 0;
 
   virtual bool isReady() = 0;
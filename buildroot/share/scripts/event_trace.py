@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+#
+# event_trace.py
+#
+# Convert an EVENT_TRACE capture into Chrome trace JSON.
+#
+# Send M132 to the printer and save everything it prints (a terminal log or a
+# host's serial.log is fine, other lines are ignored). Several M132 dumps in
+# one capture are joined in order. Open the result in chrome://tracing or
+# https://ui.perfetto.dev.
+#
+# Timestamps are 32 bits and wrap (about 60s on a 72MHz DWT counter, 71
+# minutes with micros()), so a gap longer than that between two events is lost.
+#
+# Usage: event_trace.py capture.log trace.json
+#
+
+import argparse, json, re
+
+# Keep in sync with EventId in Marlin/src/feature/event_trace.h
+EV_BLOCK_QUEUED, EV_BLOCK_START, EV_BLOCK_DONE, EV_CMD_BEGIN, EV_CMD_END, \
+EV_SD_READ_BEGIN, EV_SD_READ_END, EV_HEATER_PWM, EV_UI_BEGIN, EV_UI_END = range(1, 11)
+
+THREADS = { 'Planner': 1, 'Stepper': 2, 'Commands': 3, 'SD card': 4, 'Display': 5 }
+
+HEADER = re.compile(r'ET:BEGIN us:(\d+) n:(\d+) lost:(\d+)')
+RECORD = re.compile(r'ET:([0-9A-Fa-f]{16})\b')
+
+def read_events(lines):
+    """Yield (microseconds, id, arg8, arg) with the timestamps unwrapped"""
+    ticks_per_us, base, last = 1, 0, None
+    for line in lines:
+        m = HEADER.search(line)
+        if m:
+            ticks_per_us = int(m.group(1)) or 1
+            if int(m.group(3)):
+                print('%s events were overwritten before this dump' % m.group(3))
+            continue
+        m = RECORD.search(line)
+        if not m: continue
+        raw = int(m.group(1), 16)
+        ticks = raw >> 32
+        if last is not None and ticks < last: base += 1 << 32
+        last = ticks
+        yield (base + ticks) / ticks_per_us, (raw >> 24) & 0xFF, (raw >> 16) & 0xFF, raw & 0xFFFF
+
+def heater_name(arg8):
+    return 'Bed' if arg8 == 0xFF else 'E%d' % arg8
+
+def convert(lines):
+    out = [ { 'ph': 'M', 'pid': 1, 'name': 'process_name', 'args': { 'name': 'Marlin' } } ]
+    out += [ { 'ph': 'M', 'pid': 1, 'tid': tid, 'name': 'thread_name', 'args': { 'name': name } } for name, tid in THREADS.items() ]
+
+    def complete(thread, name, start, end, args=None):
+        out.append({ 'ph': 'X', 'pid': 1, 'tid': THREADS[thread], 'name': name, 'ts': start, 'dur': max(0, end - start), 'args': args or {} })
+
+    def counter(name, ts, args):
+        out.append({ 'ph': 'C', 'pid': 1, 'name': name, 'ts': ts, 'args': args })
+
+    block_start, open_cmd, open_sd, open_ui = {}, None, None, None
+    for ts, ev, arg8, arg in read_events(lines):
+        if ev == EV_BLOCK_QUEUED:
+            out.append({ 'ph': 'i', 's': 't', 'pid': 1, 'tid': THREADS['Planner'], 'name': 'queued %d' % arg8, 'ts': ts })
+            counter('Planner blocks', ts, { 'blocks': arg })
+        elif ev == EV_BLOCK_START:
+            block_start[arg8] = ts
+            counter('Planner blocks', ts, { 'blocks': arg })
+        elif ev == EV_BLOCK_DONE:
+            if arg8 in block_start: complete('Stepper', 'block %d' % arg8, block_start.pop(arg8), ts)
+            counter('Planner blocks', ts, { 'blocks': max(0, arg - 1) })
+        elif ev == EV_CMD_BEGIN:
+            open_cmd = (ts, arg)
+        elif ev == EV_CMD_END:
+            if open_cmd:
+                name = '%c%d' % (arg8, arg) if 32 < arg8 < 127 else 'command'
+                complete('Commands', name, open_cmd[0], ts, { 'queued': open_cmd[1] })
+                counter('Command queue', open_cmd[0], { 'commands': open_cmd[1] })
+            open_cmd = None
+        elif ev == EV_SD_READ_BEGIN:
+            open_sd = (ts, arg8, arg)
+        elif ev == EV_SD_READ_END:
+            if open_sd:
+                complete('SD card', 'read %d' % open_sd[1], open_sd[0], ts, { 'block (low 16 bits)': open_sd[2], 'failed': bool(arg8) })
+            open_sd = None
+        elif ev == EV_HEATER_PWM:
+            counter('Heater %s PWM' % heater_name(arg8), ts, { 'pwm': arg })
+        elif ev == EV_UI_BEGIN:
+            open_ui = ts
+        elif ev == EV_UI_END:
+            if open_ui is not None: complete('Display', 'page' if arg8 else 'redraw', open_ui, ts)
+            open_ui = None
+
+    return { 'traceEvents': out, 'displayTimeUnit': 'ms' }
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert an M132 event trace to Chrome trace JSON')
+    parser.add_argument('input')
+    parser.add_argument('output')
+    args = parser.parse_args()
+
+    with open(args.input, errors='replace') as f:
+        trace = convert(f)
+    with open(args.output, 'w') as f:
+        json.dump(trace, f)
+    print('%d trace events written' % len(trace['traceEvents']))
+
+if __name__ == '__main__':
+    main()
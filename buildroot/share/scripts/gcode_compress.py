@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+#
+# gcode_compress.py
+#
+# Compress G-code for printing from SD with SD_COMPRESSED_GCODE.
+#
+# The G-code is split into blocks that are compressed on their own with
+# heatshrink (window 8, lookahead 4, the settings built into Marlin), and
+# an index of block offsets is appended so the printer can resume anywhere.
+# See Marlin/src/sd/compressed_gcode.h for the layout.
+#
+# Usage: gcode_compress.py [-d] [-b SHIFT] input output
+#   -d        Decompress instead, to check a file
+#   -b SHIFT  Block size as a power of 2 (8-15, default 12 = 4096 bytes)
+#
+
+import argparse, struct
+
+MAGIC = b'MHSG'
+VERSION = 1
+WINDOW_BITS = 8
+LOOKAHEAD_BITS = 4
+HEADER = struct.Struct('<4sBBBBII')
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.byte = 0
+        self.bits = 0
+
+    def put(self, value, count):
+        for i in range(count - 1, -1, -1):
+            self.byte = (self.byte << 1) | ((value >> i) & 1)
+            self.bits += 1
+            if self.bits == 8:
+                self.out.append(self.byte)
+                self.byte = self.bits = 0
+
+    def flush(self):
+        if self.bits:
+            self.out.append(self.byte << (8 - self.bits))
+            self.byte = self.bits = 0
+        return bytes(self.out)
+
+def compress_block(data):
+    window, longest = 1 << WINDOW_BITS, 1 << LOOKAHEAD_BITS
+    w = BitWriter()
+    i = 0
+    while i < len(data):
+        # Find the longest match starting within the window. It may run into the bytes being matched.
+        best_len, best_pos = 0, 0
+        start = max(0, i - window)
+        length = 2
+        while length <= longest and i + length <= len(data):
+            pos = data.rfind(data[i:i + length], start, i + length - 1)
+            if pos < 0: break
+            best_len, best_pos = length, pos
+            length += 1
+        if best_len >= 2:
+            w.put(0, 1)
+            w.put(i - best_pos - 1, WINDOW_BITS)
+            w.put(best_len - 1, LOOKAHEAD_BITS)
+            i += best_len
+        else:
+            w.put(1, 1)
+            w.put(data[i], 8)
+            i += 1
+    return w.flush()
+
+def decompress_block(data, size):
+    out = bytearray()
+    bitpos = 0
+
+    def get(count):
+        nonlocal bitpos
+        value = 0
+        for _ in range(count):
+            value = (value << 1) | ((data[bitpos >> 3] >> (7 - (bitpos & 7))) & 1)
+            bitpos += 1
+        return value
+
+    while len(out) < size:
+        if get(1):
+            out.append(get(8))
+        else:
+            dist, count = get(WINDOW_BITS) + 1, get(LOOKAHEAD_BITS) + 1
+            for _ in range(min(count, size - len(out))):
+                out.append(out[-dist])
+    return bytes(out)
+
+def compress(data, block_shift):
+    block_size = 1 << block_shift
+    body, offsets = bytearray(), []
+    for start in range(0, len(data), block_size):
+        packed = compress_block(data[start:start + block_size])
+        offsets.append(HEADER.size + len(body))
+        body += struct.pack('<H', len(packed)) + packed
+    index = HEADER.size + len(body)
+    header = HEADER.pack(MAGIC, VERSION, WINDOW_BITS, LOOKAHEAD_BITS, block_shift, len(data), index)
+    return header + bytes(body) + struct.pack('<%dI' % len(offsets), *offsets)
+
+def decompress(blob):
+    magic, version, window, lookahead, block_shift, size, index = HEADER.unpack_from(blob)
+    if magic != MAGIC or version != VERSION or window != WINDOW_BITS or lookahead != LOOKAHEAD_BITS:
+        raise ValueError('Not a compressed G-code file')
+    out = bytearray()
+    count = (size + (1 << block_shift) - 1) >> block_shift
+    for offset in struct.unpack_from('<%dI' % count, blob, index):
+        length, = struct.unpack_from('<H', blob, offset)
+        out += decompress_block(blob[offset + 2:offset + 2 + length], min(1 << block_shift, size - len(out)))
+    return bytes(out)
+
+def main():
+    parser = argparse.ArgumentParser(description='Compress G-code for SD_COMPRESSED_GCODE')
+    parser.add_argument('-d', action='store_true', help='decompress')
+    parser.add_argument('-b', type=int, default=12, choices=range(8, 16), metavar='SHIFT', help='block size as a power of 2')
+    parser.add_argument('input')
+    parser.add_argument('output')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        data = f.read()
+    result = decompress(data) if args.d else compress(data, args.b)
+    with open(args.output, 'wb') as f:
+        f.write(result)
+    if not args.d:
+        print('%d -> %d bytes (%.1f%%)' % (len(data), len(result), 100.0 * len(result) / max(1, len(data))))
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+#
+# sim_farm.py
+#
+# Run a farm of LINUX simulator instances for load testing host software.
+#
+# Each printer runs in its own directory (DIR/printer_00, printer_01, ...)
+# so its eeprom.dat and other output files are its own, and serves its
+# serial port on TCP 127.0.0.1:PORT+n. An EEPROM image can be copied in as
+# the starting point. Each instance's stdout and stderr go to sim.log in its
+# directory. Ctrl-C stops them all.
+#
+# Usage: sim_farm.py [-n COUNT] [-p PORT] [-d DIR] [-e EEPROM] [-b BAUD] [-l US] marlin
+#
+
+import argparse, os, shutil, signal, subprocess, sys, time
+
+def main():
+    parser = argparse.ArgumentParser(description='Run several LINUX simulator instances')
+    parser.add_argument('-n', '--count', type=int, default=4, help='number of printers (default 4)')
+    parser.add_argument('-p', '--port', type=int, default=8000, help='TCP port of the first printer (default 8000)')
+    parser.add_argument('-d', '--dir', default='farm', help='directory for the instances (default farm)')
+    parser.add_argument('-e', '--eeprom', help='eeprom.dat to start each printer with')
+    parser.add_argument('-b', '--baud', type=int, default=0, help='simulated baud rate')
+    parser.add_argument('-l', '--latency', type=int, default=0, help='simulated latency in microseconds')
+    parser.add_argument('marlin', help='the simulator binary')
+    args = parser.parse_args()
+
+    binary = os.path.abspath(args.marlin)
+    printers = []
+    for n in range(args.count):
+        name = 'printer_%02d' % n
+        path = os.path.join(args.dir, name)
+        os.makedirs(path, exist_ok=True)
+        if args.eeprom: shutil.copyfile(args.eeprom, os.path.join(path, 'eeprom.dat'))
+        cmd = [ binary, '-t', str(args.port + n) ]
+        if args.baud: cmd += [ '-b', str(args.baud) ]
+        if args.latency: cmd += [ '-l', str(args.latency) ]
+        log = open(os.path.join(path, 'sim.log'), 'w')
+        proc = subprocess.Popen(cmd, cwd=path, stdin=subprocess.DEVNULL, stdout=log, stderr=subprocess.STDOUT)
+        printers.append((name, args.port + n, proc))
+        print('%s  127.0.0.1:%d  pid %d' % (name, args.port + n, proc.pid))
+
+    def stop(*_):
+        for _, _, proc in printers:
+            if proc.poll() is None: proc.terminate()
+        for _, _, proc in printers:
+            try: proc.wait(5)
+            except subprocess.TimeoutExpired: proc.kill()
+        sys.exit(0)
+
+    signal.signal(signal.SIGINT, stop)
+    signal.signal(signal.SIGTERM, stop)
+
+    while True:
+        time.sleep(1)
+        for name, port, proc in printers:
+            if proc.returncode is None and proc.poll() is not None:
+                print('%s exited with code %d' % (name, proc.returncode))
+        if all(proc.returncode is not None for _, _, proc in printers): break
+
+if __name__ == '__main__':
+    main()
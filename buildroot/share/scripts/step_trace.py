@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+#
+# step_trace.py
+#
+# Convert a step trace from the LINUX simulator into CSV.
+#
+# Build the simulator with STEP_ORACLE_TRACE (Marlin/src/HAL/LINUX/main.cpp)
+# and it writes every step to step_trace.bin. Each row of the CSV is one step
+# with its time, axis, direction, the axis position in steps and mm, and the
+# time since the previous step on the same axis.
+#
+# Usage: step_trace.py [-a AXES] step_trace.bin steps.csv
+#   -a AXES  Only these axes, e.g. XY
+#
+
+import argparse, struct
+
+MAGIC = b'MSTP'
+VERSION = 1
+HEADER = struct.Struct('<4sBBxx')
+RECORD = struct.Struct('<IB')
+SKIP = 0x7F
+NAMES = 'XYZE'
+
+def read_steps(data):
+    """Yield (ns, axis, forward) for each step"""
+    magic, version, axes = HEADER.unpack_from(data)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError('Not a version %d step trace' % VERSION)
+    steps_per_mm = struct.unpack_from('<%df' % axes, data, HEADER.size)
+    yield steps_per_mm
+    ns = 0
+    for offset in range(HEADER.size + 4 * axes, len(data) - RECORD.size + 1, RECORD.size):
+        dt, code = RECORD.unpack_from(data, offset)
+        ns += dt
+        if code != SKIP: yield ns, code & 0x7F, bool(code & 0x80)
+
+def convert(data, out, only):
+    steps = read_steps(data)
+    steps_per_mm = next(steps)
+    position, last = [0] * len(steps_per_mm), [None] * len(steps_per_mm)
+    out.write('time_s,axis,dir,steps,mm,interval_us\n')
+    count = 0
+    for ns, axis, forward in steps:
+        position[axis] += 1 if forward else -1
+        interval = '' if last[axis] is None else '%.3f' % ((ns - last[axis]) / 1000)
+        last[axis] = ns
+        name = NAMES[axis] if axis < len(NAMES) else str(axis)
+        if only and name not in only: continue
+        out.write('%.9f,%s,%d,%d,%.4f,%s\n' % (ns / 1e9, name, 1 if forward else -1, position[axis], position[axis] / (steps_per_mm[axis] or 1), interval))
+        count += 1
+    return count
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a simulator step trace to CSV')
+    parser.add_argument('-a', '--axes', default='', help='only these axes, e.g. XY')
+    parser.add_argument('input')
+    parser.add_argument('output')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        data = f.read()
+    with open(args.output, 'w') as f:
+        count = convert(data, f, args.axes.upper())
+    print('%d steps written' % count)
+
+if __name__ == '__main__':
+    main()